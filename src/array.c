@@ -0,0 +1,243 @@
+#include "defs.h"
+#include "array.h"
+#include "value.h"
+#include "cons.h"
+#include "stack.h"
+#include "interpret.h"
+#include "error.h"
+
+/*
+ *	Arrays.
+ *	The elements are stored as they are given, unevaluated, and are
+ *	entered with an update frame when they are used, so each is
+ *	evaluated at most once, as a list element would be.
+ *
+ *	Blocks are not kept in the values of CAFs between evaluations
+ *	(cf keep_cafs()), so all those left at the start of an evaluation
+ *	can be freed.
+ */
+
+#define	MAX_ARRAY	0x7fffffffL	/* max. no. of elements (checked) */
+#define	ARRAY_GC_BYTES	0x1000000L	/* min. allocation between collections */
+
+static Array	*arrays;	/* all the blocks in use */
+static size_t	new_bytes;	/* allocated since the last collection */
+static size_t	live_bytes;	/* kept at the last collection */
+
+static	char	p_end[] = { P_END };
+
+static long	eval_spine(Cell *list, long *nchars);
+
+/*
+ *	Convert a list, in head normal form, to an array.
+ *	The spine is evaluated first (its cells are updated in place,
+ *	so it all stays reachable from the list on the stack), and the
+ *	elements are then collected in a block of the right size.
+ */
+Cell *
+list2array(Cell *list)
+{
+	Cell	*cp;
+	long	nchars;
+	int	i;
+
+	chk_stack(1);
+	Push(list);
+	auto n = eval_spine(list, &nchars);
+	/* characters of packed strings need cells of their own */
+	chk_heap(NOCELL, nchars + 1);
+	auto block = new_block(n, sizeof(Cell *));
+	i = 0;
+	for (cp = follow(Pop()); ; cp = follow(cp))
+		if (cp->c_class == C_STRING) {
+			for (int j = 0; j < cp->c_nchars; j++)
+				block->a_elt[i++] = new_char(StrChars(cp)[j]);
+			cp = cp->c_rest;
+		} else if (cp->c_class == C_CONS) {
+			block->a_elt[i++] = follow(cp->c_arg)->c_left;
+			cp = follow(cp->c_arg)->c_right;
+		} else
+			break;
+	return new_array(block, 0, (int)n);
+}
+
+/*
+ *	Evaluate the spine of a list, which is on the stack, returning
+ *	its length, and setting *nchars to the number of characters in
+ *	packed strings.
+ */
+static long
+eval_spine(Cell *list, long *nchars)
+{
+	long	n;
+
+	n = *nchars = 0;
+	for (auto cp = head_evaluate(list); ; cp = head_evaluate(cp))
+		if (cp->c_class == C_STRING) {
+			n += cp->c_nchars;
+			*nchars += cp->c_nchars;
+			cp = cp->c_rest;
+		} else if (cp->c_class == C_CONS) {
+			n++;
+			cp = head_evaluate(cp->c_arg)->c_right;
+		} else
+			return n;
+}
+
+Cell *
+array2list(Cell *arg)
+{
+	chk_heap(arg, ListCells(arg->c_size));
+	return array_list(arg);
+}
+
+Cell *
+array_list(Cell *array)
+{
+	auto elts = array->c_block->a_elt + array->c_start;
+	auto list = new_cnst(nil);
+	for (int i = array->c_size; i-- > 0; )
+		list = new_cons(cons, new_pair(elts[i], list));
+	return list;
+}
+
+Cell *
+array_length(Cell *arg)
+{
+	return new_num((Num)arg->c_size);
+}
+
+/*
+ *	An element, entered with an update frame, as a variable would be.
+ */
+Cell *
+array_sub(Cell *arg)
+{
+	auto array = arg->c_left;
+	auto i = array_index(arg->c_right, array->c_size, "array");
+	return new_dirs(p_end, array->c_block->a_elt[array->c_start + i]);
+}
+
+/* the elements from i up to (but not including) j, sharing the block */
+Cell *
+array_slice(Cell *arg)
+{
+	auto array = arg->c_left;
+	auto i = array_index(arg->c_right->c_left, array->c_size + 1, "array");
+	auto j = array_index(arg->c_right->c_right, array->c_size + 1, "array");
+	if (j < i)
+		error(EXECERR, "array index out of range");
+	return new_array(array->c_block, array->c_start + i, j - i);
+}
+
+/*
+ *	A copy of an array, with elements replaced according to a list of
+ *	pairs of indices and values, later pairs taking precedence.
+ *	The argument is a pair in head normal form: the indices are
+ *	evaluated, but not the new values.
+ */
+Cell *
+array_update(Cell *arg)
+{
+	Cell	*cp;
+	long	nchars;
+
+	chk_stack(1);
+	Push(arg);
+	auto array = head_evaluate(arg->c_left);
+	(void)eval_spine(arg->c_right, &nchars);
+	for (cp = follow(arg->c_right); cp->c_class == C_CONS;
+	     cp = follow(follow(cp->c_arg)->c_right)) {
+		auto upd = head_evaluate(follow(cp->c_arg)->c_left);
+		(void)array_index(head_evaluate(upd->c_left), array->c_size,
+				  "array");
+	}
+	chk_heap(NOCELL, 1);
+	auto block = new_block(array->c_size, sizeof(Cell *));
+	(void)memcpy(block->a_elt, array->c_block->a_elt + array->c_start,
+		array->c_size*sizeof(Cell *));
+	for (cp = follow(arg->c_right); cp->c_class == C_CONS;
+	     cp = follow(follow(cp->c_arg)->c_right)) {
+		auto upd = follow(follow(cp->c_arg)->c_left);
+		block->a_elt[(int)follow(upd->c_left)->c_num] = upd->c_right;
+	}
+	Pop_void();
+	return new_array(block, 0, array->c_size);
+}
+
+int
+array_index(Cell *n, int limit, const char *kind)
+{
+	auto i = n->c_num;
+	if (i != floor(i) || i < 0 || i >= limit)
+		error(EXECERR, "%s index out of range", kind);
+	return (int)i;
+}
+
+Array *
+new_block(long size, size_t eltsize)
+{
+	Array	*block;
+	size_t	bytes;
+
+	bytes = sizeof(Array) + size*eltsize;
+	if (size > MAX_ARRAY || (block = (Array *)malloc(bytes)) == nullptr)
+		error(EXECERR, "array too large");
+	new_bytes += bytes;
+	block->a_bytes = bytes;
+	block->a_size = (int)size;
+	block->a_marked = FALSE;
+	block->a_next = arrays;
+	arrays = block;
+	return block;
+}
+
+Cell *
+new_array(Array *block, int start, int size)
+{
+	auto cp = new_cell(C_ARRAY);
+	cp->c_block = block;
+	cp->c_start = start;
+	cp->c_size = size;
+	return cp;
+}
+
+/*
+ *	Collect garbage when the blocks allocated since the last collection
+ *	are more than those kept then, so that the space used for blocks
+ *	at most doubles between collections.
+ */
+Bool
+arrays_full(void)
+{
+	return new_bytes > ARRAY_GC_BYTES && new_bytes > live_bytes;
+}
+
+void
+sweep_arrays(void)
+{
+	Array	*block;
+
+	new_bytes = live_bytes = 0;
+	for (auto bp = &arrays; (block = *bp) != nullptr; )
+		if (block->a_marked) {
+			block->a_marked = FALSE;
+			live_bytes += block->a_bytes;
+			bp = &block->a_next;
+		} else {
+			*bp = block->a_next;
+			free(block);
+		}
+}
+
+void
+free_arrays(void)
+{
+	Array	*block;
+
+	new_bytes = live_bytes = 0;
+	while ((block = arrays) != nullptr) {
+		arrays = block->a_next;
+		free(block);
+	}
+}
@@ -0,0 +1,73 @@
+#ifndef ARRAY_H
+#define ARRAY_H
+
+/*
+ *	Arrays: immutable sequences of values, indexed in constant time.
+ */
+
+#include "defs.h"
+#include "num.h"
+
+/*
+ *	An array value is a cell (C_ARRAY) holding a slice of a block of
+ *	elements, so that slices share their block.  Blocks are allocated
+ *	outside the heap, and freed by the garbage collector when no cell
+ *	refers to them any more (cf runtime.c).
+ *	Vectors (C_VECTOR, cf vector.h) are slices of blocks of numbers.
+ */
+struct _Array {
+	Array	*a_next;	/* the other blocks in use */
+	Bool	a_marked;	/* reached in this garbage collection */
+	size_t	a_bytes;	/* allocated for the block */
+	int	a_size;
+	union {
+		Cell	*au_elt[1];	/* ARRAY: unevaluated values */
+		Num	au_num[1];	/* VECTOR */
+	} a_union;		/* a_size of them */
+};
+
+#define	a_elt	a_union.au_elt
+#define	a_num	a_union.au_num
+
+/*
+ *	A block of size elements of eltsize bytes each, to be filled in
+ *	and put in a cell before the next garbage collection.
+ */
+extern	Array	*new_block(long size, size_t eltsize);
+
+/* a cell holding size elements of block, starting at start */
+extern	Cell	*new_array(Array *block, int start, int size);
+
+/* the built-in functions */
+extern	Cell	*list2array(Cell *list);
+extern	Cell	*array2list(Cell *arg);
+extern	Cell	*array_length(Cell *arg);
+extern	Cell	*array_sub(Cell *arg);
+extern	Cell	*array_slice(Cell *arg);
+extern	Cell	*array_update(Cell *arg);
+
+/*
+ *	A number, which must be a whole number from 0 up to limit-1,
+ *	indexing an array or vector (kind, for the error message).
+ */
+extern	int	array_index(Cell *n, int limit, const char *kind);
+
+/*
+ *	The elements of an array as a list, which takes ListCells(n)
+ *	free cells for n elements.
+ */
+#define	ListCells(n)	(2*(n) + 1)
+extern	Cell	*array_list(Cell *array);
+
+/*
+ *	For the garbage collector:
+ *	arrays_full()	so much has been allocated for blocks since the
+ *			last garbage collection that another is due.
+ *	sweep_arrays()	free the blocks not marked, and clear the marks.
+ *	free_arrays()	free all blocks, at the start of an evaluation.
+ */
+extern	Bool	arrays_full(void);
+extern	void	sweep_arrays(void);
+extern	void	free_arrays(void);
+
+#endif
@@ -7,15 +7,24 @@
 #include "cases.h"
 #include "interpret.h"
 #include "stream.h"
+#include "array.h"
+#include "vector.h"
+#include "sort.h"
+#include "hash.h"
+#include "list.h"
+#include "text_fns.h"
 #include "output.h"
 #include "error.h"
+#include "strict.h"
 
 #define	MAX_TMP_STRING	1024
 
 
 static void	def_builtin(const char *name, Function *fn);
+static void	def_hnf_builtin(const char *name, Function *fn);
 static void	def_1math(const char *name, Unary *fn);
 static void	def_2math(const char *name, Binary *fn);
+static void	def_strict(const char *name);
 static Bool	check_arity(Type *type, int n);
 
 static Cell	*ord(Cell *arg);
@@ -41,9 +50,53 @@ init_builtins(void)
 	def_builtin("num2str",	num2str 	);
 	def_builtin("str2num",	str2num 	);
 	def_builtin("error",	user_error 	);
+	def_strict("strict");
 
-	def_builtin("print",	print_value 	);
+	def_hnf_builtin("list2array",	list2array	);
+	def_builtin("array2list",	array2list	);
+	def_builtin("array_length",	array_length	);
+	def_builtin("array_sub",	array_sub	);
+	def_builtin("array_slice",	array_slice	);
+	def_hnf_builtin("array_update",	array_update	);
+
+	def_hnf_builtin("list2vector",	list2vector	);
+	def_builtin("vector2list",	vector2list	);
+	def_builtin("vector_length",	vector_length	);
+	def_builtin("vector_sub",	vector_sub	);
+	def_builtin("vector_slice",	vector_slice	);
+	def_builtin("vector_plus",	vector_plus	);
+	def_builtin("vector_minus",	vector_minus	);
+	def_builtin("vector_times",	vector_times	);
+	def_builtin("vector_scale",	vector_scale	);
+	def_builtin("vector_dot",	vector_dot	);
+	def_builtin("vector_sum",	vector_sum	);
+	def_builtin("vector_min",	vector_min	);
+	def_builtin("vector_max",	vector_max	);
+	def_builtin("vector_scan",	vector_scan	);
+
+	def_hnf_builtin("sort",		sort		);
+	def_hnf_builtin("sort_by",	sort_by		);
+
+	def_hnf_builtin("list_length",	list_length	);
+	def_hnf_builtin("list_reverse",	list_reverse	);
+	def_hnf_builtin("list_sum",	list_sum	);
+	def_hnf_builtin("list_product",	list_product	);
+	def_hnf_builtin("list_front",	list_front	);
+	def_hnf_builtin("list_after",	list_after	);
+
+	def_hnf_builtin("text_lines",	text_lines	);
+	def_hnf_builtin("text_unlines",	text_unlines	);
+	def_hnf_builtin("text_words",	text_words	);
+	def_hnf_builtin("split",	text_split	);
+	def_hnf_builtin("join",		text_join	);
+	def_hnf_builtin("text_search",	text_search	);
+
+	def_hnf_builtin("hash",		hash		);
+	def_hnf_builtin("memo_call",	memo_call	);
+
+	def_hnf_builtin("print",	print_value	);
 	def_builtin("write_element",	write_value 	);
+	def_hnf_builtin("write_list",	write_list	);
 
 	def_2math("+",		plus		);
 	def_2math("-",		minus		);
@@ -94,6 +147,22 @@ def_builtin(const char *name, Function *fn)
 	bu->f_code = strict(builtin_expr(fn));
 	bu->f_arity = 1;
 	bu->f_branch = nullptr;
+	bu->f_strict[0] = STRICT_ALL;
+}
+
+/*
+ * A built-in function given its argument in head normal form only.
+ */
+static void
+def_hnf_builtin(const char *name, Function *fn)
+{
+	auto bu = fn_lookup(newstring(name));
+	if (bu == nullptr)
+		error(LIBERR, "'%s': undeclared built-in", name);
+	bu->f_code = strict_part(builtin_expr(fn), p_stash(p_new()));
+	bu->f_arity = 1;
+	bu->f_branch = nullptr;
+	bu->f_strict[0] = StrictBit(1);
 }
 
 static void
@@ -107,6 +176,7 @@ def_1math(const char *name, Unary *fn)
 	bu->f_code = strict(bu_1math_expr(fn));
 	bu->f_arity = 1;
 	bu->f_branch = nullptr;
+	bu->f_strict[0] = STRICT_ALL;
 }
 
 static void
@@ -120,6 +190,24 @@ def_2math(const char *name, Binary *fn)
 	bu->f_code = strict(bu_2math_expr(fn));
 	bu->f_arity = 1;
 	bu->f_branch = nullptr;
+	bu->f_strict[0] = STRICT_ALL;
+}
+
+/*
+ * strict(x, y) evaluates x to head normal form, and then y, like seq
+ * in Haskell (but seq is the name of a type in the seq module).
+ */
+static void
+def_strict(const char *name)
+{
+	auto bu = fn_lookup(newstring(name));
+	if (bu == nullptr)
+		error(LIBERR, "'%s': undeclared built-in", name);
+	auto part = p_stash(p_reverse(p_push(P_LEFT, p_new())));
+	bu->f_code = strict_part(dir_expr(p_push(P_RIGHT, p_new())), part);
+	bu->f_arity = 1;
+	bu->f_branch = nullptr;
+	bu->f_strict[0] = StrictBit(1) | StrictBit(2);
 }
 
 static Bool
@@ -165,7 +253,7 @@ num2str(Cell *arg)
 {
 	Byte	strval[MAX_TMP_STRING];
 
-    (void)snprintf((char *)strval, sizeof(strval), NUMfmt, arg->c_num);
+	(void)fmt_num((char *)strval, arg->c_num);
 	return c2hope(strval);
 }
 
@@ -190,20 +278,23 @@ user_error(Cell *arg)
 }
 
 /*
- *	Convert a C string to a string value.
+ *	Convert a C string to a string value, packed.
  */
 Cell *
 c2hope(const Byte *str)
 {
-	const	Byte	*sp;
-	Cell	*cp;
-	int	len;
+	SChar	chunk[STR_CHUNK];
+	int	len, n;
 
 	len = strlen((const char *)str);
-	chk_heap(NOCELL, 3*len+1);
-	cp = new_cnst(nil);
-	for (sp = str+len-1; sp >= str; sp--)
-		cp = new_cons(cons, new_pair(new_char(*sp), cp));
+	chk_heap(NOCELL, (len + STR_CHUNK-1)/STR_CHUNK + 1);
+	auto cp = new_cnst(nil);
+	for ( ; len > 0; len -= n) {
+		n = len < (int)STR_CHUNK ? len : STR_CHUNK;
+		for (int i = 0; i < n; i++)
+			chunk[i] = str[len-n+i];
+		cp = new_string(chunk, n, cp);
+	}
 	return cp;
 }
 
@@ -214,10 +305,21 @@ c2hope(const Byte *str)
 void
 hope2c(Byte *s, int n, Cell *arg)
 {
-	for ( ; n > 0 && arg->c_class == C_CONS; arg = arg->c_arg->c_right) {
-		*s++ = arg->c_arg->c_left->c_char;
-		n--;
-	}
+	int	len;
+
+	while (n > 0)
+		if (arg->c_class == C_CONS) {
+			*s++ = arg->c_arg->c_left->c_char;
+			n--;
+			arg = arg->c_arg->c_right;
+		} else if (arg->c_class == C_STRING) {
+			len = arg->c_nchars < n ? arg->c_nchars : n;
+			for (int i = 0; i < len; i++)
+				*s++ = StrChars(arg)[i];
+			n -= len;
+			arg = arg->c_rest;
+		} else
+			break;
 	if (n == 0)
 		error(EXECERR, "%s: string too long", cur_function);
 	*s = '\0';
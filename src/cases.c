@@ -57,6 +57,15 @@ strict(Expr *real)
 	auto code = NEW(UCase);
 	code->uc_class = uc_type::UC_STRICT;
 	code->uc_real = real;
+	code->uc_part = nullptr;
+	return code;
+}
+
+UCase *
+strict_part(Expr *real, Path part)
+{
+	auto code = strict(real);
+	code->uc_part = part;
 	return code;
 }
 
@@ -84,6 +93,7 @@ copy_ucase(UCase *old)
         break;
     case uc_type::UC_STRICT:
 		new_ucase->uc_real = old->uc_real;
+		new_ucase->uc_part = old->uc_part;
         break;
 	}
 	return new_ucase;
@@ -123,6 +133,14 @@ char_case(UCase *def)
 	return lcase;
 }
 
+LCase *
+eval_case(UCase *body)
+{
+	auto lcase = alg_case((Natural)1, body);
+	lcase->lc_class = lc_type::LC_EVAL;
+	return lcase;
+}
+
 static LCase *
 copy_lcase(LCase *old)
 {
@@ -132,6 +150,7 @@ copy_lcase(LCase *old)
 	switch (old->lc_class) {
 	case lc_type::LC_ALGEBRAIC:
     case lc_type::LC_NUMERIC:
+    case lc_type::LC_EVAL:
 		new_lcase->lc_limbs = NEWARRAY(UCase *, old->lc_arity);
 		for (decltype(old->lc_arity) i = 0; i < old->lc_arity; i++)
 			new_lcase->lc_limbs[i] = new_reference(old->lc_limbs[i]);
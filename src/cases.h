@@ -26,7 +26,11 @@ struct _UCase {
 			LCase	*ucu_cases;
 		} uc_case;
 		Func	*ucu_defun;	/* F_NOMATCH */
-		Expr	*ucu_expr;	/* L_NOMATCH, STRICT */
+		Expr	*ucu_expr;	/* L_NOMATCH */
+		struct {		/* STRICT */
+			Expr	*ucu_real;
+			Path	ucu_part;
+		} uc_strict;
 		struct {		/* SUCCESS */
 			int	ucu_size;
 			Expr	*ucu_body;
@@ -39,7 +43,8 @@ struct _UCase {
 #define	uc_cases uc_union.uc_case.ucu_cases	/* CASE */
 #define	uc_defun uc_union.ucu_defun		/* F_NOMATCH */
 #define	uc_who	uc_union.ucu_expr		/* L_NOMATCH */
-#define	uc_real	uc_union.ucu_expr		/* STRICT */
+#define	uc_real	uc_union.uc_strict.ucu_real	/* STRICT */
+#define	uc_part	uc_union.uc_strict.ucu_part	/* STRICT */
 #define	uc_body	uc_union.uc_success.ucu_body	/* SUCCESS */
 #define	uc_size	uc_union.uc_success.ucu_size	/* SUCCESS */
 
@@ -48,6 +53,8 @@ extern	UCase	*f_nomatch(Func *defun);
 extern	UCase	*l_nomatch(Expr *who);
 extern	UCase	*success(Expr *body, int size);
 extern	UCase	*strict(Expr *real);
+/* strict only in a part of its argument, to head normal form */
+extern	UCase	*strict_part(Expr *real, Path part);
 extern	UCase	*copy_ucase(UCase *old);
 
 /*
@@ -57,7 +64,8 @@ extern	UCase	*copy_ucase(UCase *old);
 enum class lc_type : short{
 	LC_ALGEBRAIC,	/* algebraic data type */
 	LC_NUMERIC,	/* numbers -- <0, 0, succ(n) */
-	LC_CHARACTER	/* characters */
+	LC_CHARACTER,	/* characters */
+	LC_EVAL		/* any value, just evaluated (strict pattern) */
 };
 
 struct _LCase {
@@ -69,7 +77,7 @@ struct _LCase {
 	} lc_union;
 };
 #define	lc_arity	lcu_arity
-#define	lc_limbs	lc_union.lcu_limbs
+#define	lc_limbs	lc_union.lcu_limbs		/* also EVAL */
 #define	lc_c_limbs	lc_union.lcu_c_limbs
 
 /* indexes for number cases */
@@ -78,5 +86,6 @@ enum { LESS, EQUAL, GREATER };
 extern	LCase	*alg_case(Natural arity, UCase *def);
 extern	LCase	*num_case(UCase *def);
 extern	LCase	*char_case(UCase *def);
+extern	LCase	*eval_case(UCase *body);
 
 #endif
@@ -4,20 +4,33 @@
 #include "cons.h"
 #include "cases.h"
 #include "value.h"
+#include "array.h"
+#include "vector.h"
 #include "path.h"
+#include "interpret.h"
 #include "error.h"
+#include "strict.h"
 
 /*
  * Comparisons
  *
  * This is all complicated by the fact that comparisons are done lazily.
+ * The parts of the values that are already evaluated are compared
+ * directly (cf cmp_prefix()), and the rest lazily.
  */
 
+/* max. nesting of pairs compared directly (cf cmp_prefix()) */
+#define	MAX_DEPTH	16
+
 static Expr	*e_cmp, *e_cmppair;
 static Cons	*c_less, *c_equal, *c_greater;
 
 static Cell	*compare(Cell *arg);
 static Cons	*cmp_args(Cell *first, Cell *second);
+static Cell	*cmp_strings(Cell *first, Cell *second);
+static int	cmp_prefix(Cell **fp, Cell **sp, int depth);
+static int	cmp_packed(Cell *first, Cell *second);
+static int	cmp_index(Cons *first, Cons *second);
 
 /*
  *	Set up comparison code
@@ -42,6 +55,7 @@ init_cmps(void)
 	fn->f_code = success(e_cmp, 0);
 	fn->f_arity = 1;
 	fn->f_branch = nullptr;
+	fn->f_strict[0] = StrictBit(1) | StrictBit(2) | StrictBit(3);
 
 	fn = fn_lookup(newstring("cmp_pair"));
 	ASSERT( fn != nullptr );
@@ -63,20 +77,48 @@ init_cmps(void)
 static Cell *
 compare(Cell *arg)
 {
-	switch (arg->c_left->c_class) {
+	auto first = follow(arg->c_left);
+	auto second = follow(arg->c_right);
+	/* as far as both are evaluated */
+	auto start = first;
+	auto c = cmp_prefix(&first, &second, MAX_DEPTH);
+	if (c != CMP_UNKNOWN)
+		return new_cnst(c < 0 ? c_less : c == 0 ? c_equal : c_greater);
+	if (first != start)	/* evaluate the rest first */
+		return new_susp(e_cmp,
+				new_pair(new_pair(first, second), NOCELL));
+	if (first->c_class == C_STRING || second->c_class == C_STRING) {
+		if (first->c_class == second->c_class)
+			return cmp_strings(first, second);
+		if (first->c_class == C_STRING)
+			first = unpack_string(first);
+		else
+			second = unpack_string(second);
+	}
+	switch (first->c_class) {
 	case C_NUM:
     case C_CHAR:
     case C_CONST:
-		return new_cnst(cmp_args(arg->c_left, arg->c_right));
+		return new_cnst(cmp_args(first, second));
 	case C_CONS:
-		return arg->c_left->c_cons == arg->c_right->c_cons ?
+		return first->c_cons == second->c_cons ?
 			new_susp(e_cmp,
-				 new_pair(new_pair(arg->c_left->c_arg,
-						  arg->c_right->c_arg),
+				 new_pair(new_pair(first->c_arg,
+						  second->c_arg),
 					  NOCELL)) :
-			new_cnst(cmp_args(arg->c_left, arg->c_right));
+			new_cnst(cmp_args(first, second));
 	case C_PAIR:
 		return new_susp(e_cmppair, new_pair(arg, NOCELL));
+	case C_VECTOR:
+		c = cmp_vectors(first, second);
+		return new_cnst(c < 0 ? c_less : c == 0 ? c_equal : c_greater);
+	case C_ARRAY:	/* as lists */
+		chk_heap(arg, ListCells(first->c_size) +
+				ListCells(second->c_size) + 3);
+		return new_susp(e_cmp,
+				new_pair(new_pair(array_list(first),
+						  array_list(second)),
+					 NOCELL));
 	default:
 		NOT_REACHED;
 	}
@@ -105,3 +147,213 @@ cmp_args(Cell *first, Cell *second)
 		NOT_REACHED;
 	}
 }
+
+/*
+ *	Two packed strings: compare the characters directly, as far as
+ *	both lists stay packed, and leave the rest to cmp.
+ */
+static Cell *
+cmp_strings(Cell *first, Cell *second)
+{
+	auto fp = StrChars(first);
+	auto sp = StrChars(second);
+	int	fn = first->c_nchars;
+	int	sn = second->c_nchars;
+	for (;;) {
+		for ( ; fn > 0 && sn > 0; fn--, sn--, fp++, sp++)
+			if (*fp != *sp)
+				return new_cnst(*fp < *sp ? c_less : c_greater);
+		if (fn == 0 && first->c_rest->c_class == C_STRING) {
+			first = first->c_rest;
+			fp = StrChars(first);
+			fn = first->c_nchars;
+		} else if (sn == 0 && second->c_rest->c_class == C_STRING) {
+			second = second->c_rest;
+			sp = StrChars(second);
+			sn = second->c_nchars;
+		} else
+			break;
+	}
+	if (fn == 0)
+		first = first->c_rest;
+	else
+		first = new_string(fp, fn, first->c_rest);
+	if (sn == 0)
+		second = second->c_rest;
+	else
+		second = new_string(sp, sn, second->c_rest);
+	return new_susp(e_cmp, new_pair(new_pair(first, second), NOCELL));
+}
+
+/*
+ *	Compare two values as far as they are already evaluated, without
+ *	evaluating or building anything, returning -1, 0 or 1 as compare()
+ *	would give LESS, EQUAL or GREATER, or CMP_UNKNOWN if that would
+ *	need a part that is not yet evaluated.
+ */
+int
+cmp_evaluated(Cell *first, Cell *second)
+{
+	return cmp_prefix(&first, &second, MAX_DEPTH);
+}
+
+/*
+ *	As cmp_evaluated(), but if the result is CMP_UNKNOWN, *fp and *sp are
+ *	left at the parts still to be compared, everything before them
+ *	(in the order compare uses) being equal.
+ *	Lists and constructors are followed iteratively, so this uses no
+ *	C stack for long lists, and the left parts of pairs (and elements
+ *	of arrays) are compared recursively only up to depth levels.
+ */
+static int
+cmp_prefix(Cell **fp, Cell **sp, int depth)
+{
+	for (;;) {
+		auto first = *fp = follow(*fp);
+		auto second = *sp = follow(*sp);
+		if (first->c_class == C_STRING && second->c_class == C_STRING)
+			return cmp_packed(first, second);
+		switch (first->c_class) {
+		case C_NUM:
+			if (second->c_class != C_NUM)
+				return CMP_UNKNOWN;
+			return first->c_num == second->c_num ? 0 :
+				first->c_num < second->c_num ? -1 : 1;
+		case C_CHAR:
+			if (second->c_class != C_CHAR)
+				return CMP_UNKNOWN;
+			return first->c_char == second->c_char ? 0 :
+				first->c_char < second->c_char ? -1 : 1;
+		case C_VECTOR: {
+			if (second->c_class != C_VECTOR)
+				return CMP_UNKNOWN;
+			auto c = cmp_vectors(first, second);
+			return c < 0 ? -1 : c == 0 ? 0 : 1;
+		}
+		case C_CONST:
+		case C_CONS:
+		case C_STRING: {
+			/* a packed string is a cons, whose arg isn't a cell */
+			if (second->c_class != C_CONST &&
+			    second->c_class != C_CONS &&
+			    second->c_class != C_STRING)
+				return CMP_UNKNOWN;
+			auto fc = first->c_class == C_STRING ? cons :
+					first->c_cons;
+			auto sc = second->c_class == C_STRING ? cons :
+					second->c_cons;
+			if (fc != sc)
+				return cmp_index(fc, sc);
+			if (first->c_class == C_CONST)
+				return 0;
+			if (first->c_class != second->c_class)
+				return CMP_UNKNOWN;
+			*fp = first->c_arg;
+			*sp = second->c_arg;
+			break;
+		}
+		case C_PAIR: {
+			if (second->c_class != C_PAIR)
+				return CMP_UNKNOWN;
+			if (depth == 0)
+				return CMP_UNKNOWN;
+			auto fl = first->c_left;
+			auto sl = second->c_left;
+			auto c = cmp_prefix(&fl, &sl, depth - 1);
+			if (c != 0)
+				return c;
+			*fp = first->c_right;
+			*sp = second->c_right;
+			break;
+		}
+		case C_ARRAY: {	/* as lists */
+			if (second->c_class != C_ARRAY || depth == 0)
+				return CMP_UNKNOWN;
+			auto fe = first->c_block->a_elt + first->c_start;
+			auto se = second->c_block->a_elt + second->c_start;
+			for (int i = 0;
+			     i < first->c_size && i < second->c_size; i++) {
+				auto fl = fe[i];
+				auto sl = se[i];
+				auto c = cmp_prefix(&fl, &sl, depth - 1);
+				if (c != 0)
+					return c;
+			}
+			return first->c_size == second->c_size ? 0 :
+				first->c_size < second->c_size ? -1 : 1;
+		}
+		default:	/* unevaluated */
+			return CMP_UNKNOWN;
+		}
+	}
+}
+
+/*
+ *	Two packed strings, compared as far as both lists stay packed, as
+ *	in cmp_strings(), and then by what follows.
+ */
+static int
+cmp_packed(Cell *first, Cell *second)
+{
+	auto fp = StrChars(first);
+	auto sp = StrChars(second);
+	int	fn = first->c_nchars;
+	int	sn = second->c_nchars;
+	for (;;) {
+		for ( ; fn > 0 && sn > 0; fn--, sn--, fp++, sp++)
+			if (*fp != *sp)
+				return *fp < *sp ? -1 : 1;
+		if (fn == 0 && follow(first->c_rest)->c_class == C_STRING) {
+			first = follow(first->c_rest);
+			fp = StrChars(first);
+			fn = first->c_nchars;
+		} else if (sn == 0 &&
+			   follow(second->c_rest)->c_class == C_STRING) {
+			second = follow(second->c_rest);
+			sp = StrChars(second);
+			sn = second->c_nchars;
+		} else
+			break;
+	}
+	/* if one has characters left, the other must end there */
+	if (sn > 0) {
+		auto rest = follow(first->c_rest);
+		return rest->c_class == C_CONST ?
+			cmp_index(rest->c_cons, cons) : CMP_UNKNOWN;
+	}
+	if (fn > 0) {
+		auto rest = follow(second->c_rest);
+		return rest->c_class == C_CONST ?
+			cmp_index(cons, rest->c_cons) : CMP_UNKNOWN;
+	}
+	return cmp_evaluated(first->c_rest, second->c_rest);
+}
+
+static int
+cmp_index(Cons *first, Cons *second)
+{
+	return first == second ? 0 :
+		first->c_index < second->c_index ? -1 : 1;
+}
+
+/*
+ *	Compare two values, evaluating them only as far as compare() would.
+ *	The caller must keep both reachable from the stack.
+ */
+int
+compare_values(Cell *first, Cell *second)
+{
+	auto c = cmp_evaluated(first, second);
+	if (c != CMP_UNKNOWN)
+		return c;
+	chk_heap(NOCELL, 3);
+	return relation_sign(head_evaluate(new_susp(e_cmp,
+				new_pair(new_pair(first, second), NOCELL))));
+}
+
+int
+relation_sign(Cell *rel)
+{
+	auto r = follow(rel)->c_cons;
+	return r == c_less ? -1 : r == c_equal ? 0 : 1;
+}
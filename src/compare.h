@@ -9,4 +9,16 @@
  */
 extern	void	init_cmps(void);
 
+/*
+ *	Comparisons returning -1, 0 or 1 for LESS, EQUAL or GREATER.
+ *	cmp_evaluated()	look only at the parts already evaluated, or
+ *			return CMP_UNKNOWN if that isn't enough.
+ *	compare_values() evaluate them as far as needed, like compare.
+ *	relation_sign()	for a relation in head normal form.
+ */
+#define	CMP_UNKNOWN	2
+extern	int	cmp_evaluated(Cell *first, Cell *second);
+extern	int	compare_values(Cell *first, Cell *second);
+extern	int	relation_sign(Cell *rel);
+
 #endif
@@ -20,9 +20,11 @@ typedef	struct {
 
 #define	NUMCASE	 10000	/* special ncases value: number match */
 #define	CHARCASE 10001	/* special ncases value: character match */
+#define	EVALCASE 10002	/* special ncases value: evaluation only */
 
 #define	IsNumCase(m)	((m)->ncases == NUMCASE)
 #define	IsCharCase(m)	((m)->ncases == CHARCASE)
+#define	IsEvalCase(m)	((m)->ncases == EVALCASE)
 
 static Match	*m_end;
 static const	Match	*cur_match;
@@ -112,6 +114,10 @@ gen_matches(int level, Path here, Expr *pattern)
 		}
 		gen_matches(level, here, pattern->e_arg);
         break;
+    case expr_type::E_BANG:
+		add_match(level, here, EVALCASE, 0);
+		gen_matches(level, here, pattern->e_rest);
+        break;
     case expr_type::E_PAIR:
 		gen_matches(level, p_push(P_LEFT, here), pattern->e_left);
 		gen_matches(level, p_push(P_RIGHT, here), pattern->e_right);
@@ -201,6 +207,8 @@ size_pattern(Expr *pattern)
 			size_pattern(pattern->e_right);
 	case expr_type::E_PLUS:
 		return size_pattern(pattern->e_rest) + pattern->e_incr;
+	case expr_type::E_BANG:	/* no more specific */
+		return size_pattern(pattern->e_rest);
 	case expr_type::E_NUM:
 		return (int)(pattern->e_num) + 1;
 	case expr_type::E_CONS:
@@ -260,7 +268,9 @@ new_node(const Match *matches, UCase *failure, UCase *subtree)
 	if (IsCharCase(matches)) {
 		limbs = char_case(failure);
 		ca_assign(limbs->lc_c_limbs, matches->index, subtree);
-	} else {
+	} else if (IsEvalCase(matches))
+		limbs = eval_case(subtree);
+	else {
 		limbs = IsNumCase(matches) ? num_case(failure) :
 				alg_case(matches->ncases, failure);
 		limbs->lc_limbs[matches->index] = subtree;
@@ -303,6 +313,14 @@ merge(UCase *old)
 		    (old->uc_level == cur_match->level &&
 		     p_less(old->uc_path, cur_match->where)))
 			limb_map(lcase, merge);
+		else if (lcase->lc_class == lc_type::LC_EVAL)
+			/* same place: evaluated here, then any other match */
+			lcase->lc_limbs[0] = IsEvalCase(cur_match) ?
+				sub_merge(lcase->lc_limbs[0]) :
+				merge(lcase->lc_limbs[0]);
+		else if (IsEvalCase(cur_match))
+			/* same place: already evaluated by this match */
+			return sub_merge(old);
 		else {	/* same place -- keep following */
 			auto i = cur_match->index;
 			if (lcase->lc_class == lc_type::LC_CHARACTER)
@@ -351,8 +369,8 @@ compile(UCase *old_body, Expr *formals, Expr *new_expr)
 UCase *
 comp_branch(UCase *old_body, Branch *branch)
 {
-	comp_expr(branch->br_expr);
-	return compile(old_body, branch->br_formals, branch->br_expr);
+	comp_expr(branch->br_body);
+	return compile(old_body, branch->br_formals, branch->br_body);
 }
 
 /*
@@ -396,6 +414,7 @@ comp_expr(Expr *expr)
     case expr_type::E_VAR:
     case expr_type::E_NCLASSES:
     case expr_type::E_PLUS:
+    case expr_type::E_BANG:
     case expr_type::E_RETURN:
     case expr_type::E_BUILTIN:
     case expr_type::E_BU_1MATH:
@@ -83,6 +83,12 @@ extern	int	yylex(void);
 extern	Bool	restricted;	/* disable file I/O */
 extern	int	time_limit;	/* evaluation time limit in seconds */
 				/* default = 0 (no limit) */
+extern	Bool	optimistic;	/* speculate cheap suspensions */
+extern	Bool	simplifying;	/* simplify expressions before compiling */
+				/* default = TRUE */
+extern	int	stack_limit;	/* max. size of run-time stack in Kbytes */
+				/* default = DEF_STACK_LIMIT */
+#define	DEF_STACK_LIMIT	(64*1024)
 
 extern	const	char	*const	*cmd_args;	/* other arguments */
 
@@ -8,6 +8,9 @@
 #include "number.h"
 #include "output.h"
 #include "type_check.h"
+#include "simplify.h"
+#include "strict.h"
+#include "usage.h"
 #include "exceptions.h"
 
 static Bool	create_environment(Expr *expr);
@@ -35,6 +38,10 @@ eval_expr(Expr *expr)
 		reset_streams();
 		if (! setjmp(execerror)) {
 			chk_expr(expr);
+			expr = simplify(expr, 1);
+			(void)fv_expr(expr);
+			expr = us_expr(expr, 0);
+			st_expr(expr);
 			comp_expr(expr);
 			interpret(e_print, expr);
 		}
@@ -52,6 +59,10 @@ wr_expr(Expr *expr, const char *file)
 		if (! setjmp(execerror)) {
 			open_out_file(file);
 			chk_list(expr);
+			expr = simplify(expr, 1);
+			(void)fv_expr(expr);
+			expr = us_expr(expr, 0);
+			st_expr(expr);
 			comp_expr(expr);
 			interpret(e_wr_list, expr);
 			save_out_file();
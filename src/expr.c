@@ -6,6 +6,11 @@
 #include "number.h"
 #include "compile.h"
 #include "type_check.h"
+#include "heap.h"
+#include "simplify.h"
+#include "strict.h"
+#include "usage.h"
+#include "unbox.h"
 #include "error.h"
 #include "path.h"
 
@@ -23,10 +28,13 @@ Func	*f_id;
 /* the following is different from any String */
 static const	char	bound_variable[] = "x'";
 
+static Expr	*join_strict(Expr *formals);
+
 Expr *
 char_expr(Char c)
 {
 	auto expr = NEW(Expr);
+	expr->e_used = ENV_ALL;
 	expr->e_class = expr_type::E_CHAR;
 	expr->e_char = c;
 	return expr;
@@ -48,6 +56,7 @@ Expr *
 num_expr(Num n)
 {
 	auto expr = NEW(Expr);
+	expr->e_used = ENV_ALL;
 	expr->e_class = expr_type::E_NUM;
 	expr->e_num = n;
 	return expr;
@@ -57,6 +66,7 @@ Expr *
 cons_expr(Cons *constr)
 {
 	auto expr = NEW(Expr);
+	expr->e_used = ENV_ALL;
 	expr->e_class = expr_type::E_CONS;
 	expr->e_const = constr;
 	return expr;
@@ -70,6 +80,7 @@ Expr *
 id_expr(String name)
 {
 	auto expr = NEW(Expr);
+	expr->e_used = ENV_ALL;
 	expr->e_class = expr_type::E_VAR;
 	expr->e_vname = name;
 	return expr;
@@ -79,8 +90,10 @@ Expr *
 dir_expr(Path where)
 {
 	auto expr = NEW(Expr);
+	expr->e_used = ENV_ALL;
 	expr->e_class = expr_type::E_PARAM;
 	expr->e_level = 0;
+	expr->e_once = FALSE;
 	expr->e_where = p_stash(p_reverse(where));
 	return expr;
 }
@@ -89,6 +102,7 @@ Expr *
 pair_expr(Expr *left, Expr *right)
 {
 	auto expr = NEW(Expr);
+	expr->e_used = ENV_ALL;
 	expr->e_class = expr_type::E_PAIR;
 	expr->e_left = left;
 	expr->e_right = right;
@@ -99,7 +113,10 @@ Expr *
 apply_expr(Expr *func, Expr *arg)
 {
 	auto expr = NEW(Expr);
+	expr->e_used = ENV_ALL;
 	expr->e_class = expr_type::E_APPLY;
+	expr->e_strict = 0;
+	expr->e_unboxed = FALSE;
 	expr->e_func = func;
 	expr->e_arg = arg;
 	return expr;
@@ -109,6 +126,7 @@ Expr *
 func_expr(Branch *branches)
 {
 	auto expr = NEW(Expr);
+	expr->e_used = ENV_ALL;
 	expr->e_class = expr_type::E_LAMBDA;
 	expr->e_branch = branches;
 	expr->e_arity = 0;
@@ -162,6 +180,7 @@ Expr *
 mu_expr(Expr *muvar, Expr *body)
 {
 	auto expr = NEW(Expr);
+	expr->e_used = ENV_ALL;
 	expr->e_class = expr_type::E_MU;
 	expr->e_muvar = apply_expr(nullptr, muvar);
 	expr->e_body = body;
@@ -200,6 +219,7 @@ Expr *
 builtin_expr(Function *fn)
 {
 	auto expr = NEW(Expr);
+	expr->e_used = ENV_ALL;
 	expr->e_class = expr_type::E_BUILTIN;
 	expr->e_fn = fn;
 	return expr;
@@ -209,6 +229,7 @@ Expr *
 bu_1math_expr(Unary *fn)
 {
 	auto expr = NEW(Expr);
+	expr->e_used = ENV_ALL;
 	expr->e_class = expr_type::E_BU_1MATH;
 	expr->e_1math = fn;
 	return expr;
@@ -218,6 +239,7 @@ Expr *
 bu_2math_expr(Binary *fn)
 {
 	auto expr = NEW(Expr);
+	expr->e_used = ENV_ALL;
 	expr->e_class = expr_type::E_BU_2MATH;
 	expr->e_2math = fn;
 	return expr;
@@ -232,7 +254,7 @@ new_branch(Expr *formals, Expr *expr, Branch *next)
 {
 	auto branch = NEW(Branch);
 	branch->br_formals = formals;
-	branch->br_expr = expr;
+	branch->br_expr = branch->br_body = expr;
 	branch->br_next = next;
 	return branch;
 }
@@ -262,10 +284,31 @@ decl_value(String name, QType *qtype)
 		if (fn != nullptr)
 			del_fn(fn);
 		new_fn(name, qtype);
+		reset_cafs();
 		preserve();
 	}
 }
 
+/*
+ *	A strict pattern $p among the arguments of a curried definition
+ *	is parsed as two arguments, $ and p: join them.
+ */
+static Expr *
+join_strict(Expr *formals)
+{
+	if (formals->e_class != expr_type::E_APPLY)
+		return formals;
+	auto func = formals->e_func;
+	if (func->e_class == expr_type::E_APPLY &&
+	    func->e_arg->e_class == expr_type::E_VAR &&
+	    func->e_arg->e_vname == newstring("$")) {
+		formals->e_arg = apply_expr(func->e_arg, formals->e_arg);
+		func = func->e_func;
+	}
+	formals->e_func = join_strict(func);
+	return formals;
+}
+
 void
 def_value(Expr *formals, Expr *body)
 {
@@ -281,6 +324,7 @@ def_value(Expr *formals, Expr *body)
 	if (formals->e_class == expr_type::E_IF)
 		formals->e_class = expr_type::E_APPLY;
 
+	formals = join_strict(formals);
 	arity = 0;
 	for (head = formals; head->e_class == expr_type::E_APPLY; head = head->e_func)
 		arity++;
@@ -303,11 +347,15 @@ def_value(Expr *formals, Expr *body)
 		if (! nr_branch(branch) ||
 		    (fn->f_explicit_dec && ! chk_func(branch, fn)))
 			return;		/* some error reported */
+		branch->br_body = simplify(body, arity);
+		(void)fv_expr(branch->br_body);
+		branch->br_body = us_expr(branch->br_body, arity);
 		if (! fn->f_explicit_def) {
 			fn->f_code = nullptr;
 			fn->f_branch = nullptr;
 			fn->f_explicit_def = TRUE;
 		}
+		st_define(fn);
 		head->e_class = expr_type::E_DEFUN;
 		head->e_defun = fn;
 		fn->f_arity = arity;
@@ -325,6 +373,8 @@ def_value(Expr *formals, Expr *body)
 		if (fn->f_code == nullptr && arity > 0)
 			fn->f_code = f_nomatch(fn);
 		fn->f_code = comp_branch(fn->f_code, branch);
+		unbox(fn);
+		reset_cafs();	/* their values may have changed */
 		preserve();
 	}
 }
@@ -12,6 +12,8 @@ typedef	Cell	*Function(Cell *value);
 typedef	Num	Unary(Num x);
 typedef	Num	Binary(Num x, Num y);
 
+#define	MAX_STRICT_ARGS	4	/* arguments covered by strictness analysis */
+
 struct _Func {
 	TabElt	f_linkage;
 	short	f_arity;
@@ -23,6 +25,11 @@ struct _Func {
 	} f_union;
 	Branch	*f_branch;
 	UCase	*f_code;
+	Cell	*f_value;	/* shared value of a constant (cf runtime.c) */
+	Expr	*f_worker;	/* taking the parts of a tuple (cf unbox.c) */
+	Expr	*f_shape;	/* of the tuple it takes apart */
+	Byte	f_strict[MAX_STRICT_ARGS];
+				/* demand on each argument (cf strict.h) */
 };
 #define	f_name	f_linkage.t_name
 #define	f_qtype	f_union.fu_qtype
@@ -52,6 +59,7 @@ enum class expr_type : char{
 /* kinds of input pattern that don't appear in expressions */
 	E_VAR,		/* variable in pattern */
 	E_PLUS,		/* p+k pattern */
+	E_BANG,		/* strict pattern $p */
 /* kinds of input expression that don't appear in patterns */
 	E_DEFUN,	/* declared function or constant */
 	E_LAMBDA,	/* anonymous (lambda) function */
@@ -83,6 +91,8 @@ typedef	char	ExprClass;
 struct _Expr {
 	enum expr_type	e_class;
 	char	e_misc_num;	/* VAR, PARAM, LAMBDA, APPLY in branch */
+	SBool	e_misc_bool;	/* PARAM, APPLY in expression */
+	Natural	e_used;		/* environment entries used (cf fv_expr()) */
 	union {	/* grab bag -- see the definitions below */
 		Num	eu_num;		/* Num */
 		Char	eu_char;	/* CHAR */
@@ -103,7 +113,7 @@ struct _Expr {
 			Expr	*eu_func;
 			Expr	*eu_arg;
 		} e_apply;
-		struct {		/* PLUS */
+		struct {		/* PLUS, BANG */
 			int	eu_incr;
 			Expr	*eu_rest;
 		} e_plus;
@@ -127,13 +137,16 @@ struct _Expr {
 #define	e_patt	e_union.e_p.eu_patt	/* PARAM */
 #define	e_level	e_misc_num		/* PARAM */
 #define	e_where	e_union.e_p.eu_where	/* PARAM */
+#define	e_once	e_misc_bool		/* PARAM (cf usage.c) */
 #define	e_left	e_union.e_pair.eu_left	/* PAIR */
 #define	e_right	e_union.e_pair.eu_right	/* PAIR */
 #define	e_func	e_union.e_apply.eu_func	/* APPLY */
 #define	e_arg	e_union.e_apply.eu_arg	/* APPLY */
 #define	e_nvars	e_misc_num		/* APPLY in branch */
+#define	e_strict e_misc_num		/* APPLY in expression (cf strict.c) */
+#define	e_unboxed e_misc_bool		/* APPLY in expression (cf unbox.c) */
 #define	e_incr	e_union.e_plus.eu_incr	/* PLUS */
-#define	e_rest	e_union.e_plus.eu_rest	/* PLUS */
+#define	e_rest	e_union.e_plus.eu_rest	/* PLUS, BANG */
 
 #define	e_defun	e_union.eu_defun	/* DEFUN */
 #define	e_arity	e_misc_num		/* LAMBDA */
@@ -147,6 +160,16 @@ struct _Expr {
 #define	e_1math	e_union.eu_1math	/* BU_1MATH */
 #define	e_2math	e_union.eu_2math	/* BU_2MATH */
 
+/*
+ * The environment entries used by an expression are a set of levels
+ * (cf e_level), with ENV_FAR standing for all levels beyond those
+ * represented individually.  Expressions not analysed by fv_expr()
+ * are taken to use everything.
+ */
+#define	ENV_FAR		((Natural)1 << 31)
+#define	ENV_ALL		(~(Natural)0)
+#define	EnvBit(level)	((level) < 31 ? (Natural)1 << (level) : ENV_FAR)
+
 /* expression constructors */
 extern	Expr	*char_expr(Char c);
 extern	Expr	*text_expr(const Byte *text, int n);
@@ -182,6 +205,7 @@ extern	Func	*f_id;
 struct _Branch {
 	Expr	*br_formals;	/* parameters in an APPLY-list */
 	Expr	*br_expr;	/* the body */
+	Expr	*br_body;	/* the body as compiled (cf simplify.c) */
 	Branch	*br_next;	/* next branch in lambda or defined fn */
 };
 
@@ -0,0 +1,242 @@
+#include "defs.h"
+#include "hash.h"
+#include "array.h"
+#include "compare.h"
+#include "cons.h"
+#include "expr.h"
+#include "path.h"
+#include "value.h"
+#include "stack.h"
+#include "interpret.h"
+#include "error.h"
+
+/*
+ *	Hashing.
+ *	Values are evaluated completely, and hashed so that values equal
+ *	under compare have equal hashes: packed strings hash as the lists
+ *	they stand for, and arrays as lists of their elements.
+ */
+
+typedef	unsigned long long	Hash;
+
+#define	MEMO_INIT	64	/* initial no. of slots in the memo table */
+
+/*
+ *	The memo table is an array (cf array.h), with two elements for each
+ *	slot: the key, a pair of function and argument, or NOCELL if the
+ *	slot is empty, and the result, a suspension of the function applied
+ *	to the argument, which is updated when it is evaluated.
+ *	Slots are found by linear probing, and the table is doubled when
+ *	it becomes half full.
+ *	It keeps everything in it reachable until the end of the evaluation.
+ */
+Cell	*memo_table;
+static int	memo_count;	/* no. of slots in use */
+
+static	char	p_end[] = { P_END };
+
+static Expr	*e_memo;	/* the function applied to the argument */
+
+static Hash	mix(Hash h, Hash x);
+static Hash	hash_num(Num n);
+static Hash	hash_value(Cell *value, Hash h);
+static Hash	hash_function(Cell *fn);
+static Bool	same_function(Cell *f, Cell *g);
+static int	find_slot(Cell *fn, Cell *value, Hash h);
+static void	grow_table(void);
+
+void
+init_memo(void)
+{
+	e_memo = apply_expr(dir_expr(p_push(P_LEFT, p_new())),
+			    dir_expr(p_push(P_RIGHT, p_new())));
+}
+
+void
+clear_memo(void)
+{
+	memo_table = NOCELL;
+	memo_count = 0;
+}
+
+/* whole numbers up to 2^32 */
+Cell *
+hash(Cell *value)
+{
+	chk_stack(1);
+	Push(value);
+	auto h = hash_value(value, 0);
+	Pop_void();
+	return new_num((Num)(h & 0xffffffffUL));
+}
+
+/*
+ *	The function applied to the argument, remembered for the rest of
+ *	the evaluation, entered with an update frame as a variable would
+ *	be.  The argument is evaluated completely, to hash it.
+ *	Functions are identified by their code and environment, which are
+ *	shared by the copies of a function value, so memo f is only
+ *	useful if it is shared, e.g. by defining it at the top level.
+ */
+Cell *
+memo_call(Cell *arg)
+{
+	chk_stack(1);
+	Push(arg);
+	auto fn = follow(head_evaluate(arg->c_left));
+	/* this may use memo_call too, changing the table */
+	auto h = hash_value(arg->c_right, hash_function(fn));
+	chk_heap(NOCELL, 5);
+	Pop_void();
+	if (2*(memo_count + 1) > (memo_table == NOCELL ? 0 :
+					memo_table->c_size/2))
+		grow_table();
+	auto i = find_slot(fn, arg->c_right, h);
+	auto slot = memo_table->c_block->a_elt + 2*i;
+	if (slot[0] == NOCELL) {
+		slot[0] = new_pair(fn, arg->c_right);
+		slot[1] = new_susp(e_memo, new_pair(slot[0], NOCELL));
+		memo_count++;
+	}
+	return new_dirs(p_end, slot[1]);
+}
+
+/*
+ *	The slot holding fn and value, or the empty one where they would
+ *	go.  No evaluation is done, as value is completely evaluated.
+ */
+static int
+find_slot(Cell *fn, Cell *value, Hash h)
+{
+	auto elts = memo_table->c_block->a_elt;
+	auto mask = memo_table->c_size/2 - 1;
+	for (auto i = (int)(h & mask); ; i = (i + 1) & mask) {
+		auto key = elts[2*i];
+		if (key == NOCELL ||
+		    (same_function(follow(key->c_left), fn) &&
+		     cmp_evaluated(key->c_right, value) == 0))
+			return i;
+	}
+}
+
+/*
+ *	Double the table (or create it), moving the entries.
+ *	Requires one free cell.
+ */
+static void
+grow_table(void)
+{
+	auto old = memo_table;
+	auto size = old == NOCELL ? MEMO_INIT : old->c_size;
+	memo_table = new_array(new_block(2*size, sizeof(Cell *)), 0, 2*size);
+	auto elts = memo_table->c_block->a_elt;
+	for (int i = 0; i < 2*size; i++)
+		elts[i] = NOCELL;
+	if (old == NOCELL)
+		return;
+	auto old_elts = old->c_block->a_elt;
+	for (int i = 0; i < old->c_size; i += 2)
+		if (old_elts[i] != NOCELL) {
+			auto fn = follow(old_elts[i]->c_left);
+			auto value = old_elts[i]->c_right;
+			auto j = find_slot(fn, value,
+					hash_value(value, hash_function(fn)));
+			elts[2*j] = old_elts[i];
+			elts[2*j+1] = old_elts[i+1];
+		}
+}
+
+/*
+ *	Evaluate the value completely, combining its hash with h.
+ *	It must be reachable from the stack.
+ */
+static Hash
+hash_value(Cell *value, Hash h)
+{
+	for (;;) {
+		value = follow(head_evaluate(follow(value)));
+		switch (value->c_class) {
+		case C_NUM:
+			return mix(h, hash_num(value->c_num));
+		case C_CHAR:
+			return mix(h, (Hash)value->c_char);
+		case C_CONST:
+			return mix(h, (Hash)value->c_cons->c_index);
+		case C_CONS:
+			h = mix(h, (Hash)value->c_cons->c_index);
+			value = value->c_arg;
+			break;
+		case C_STRING: {
+			auto s = StrChars(value);
+			for (int i = 0; i < value->c_nchars; i++)
+				h = mix(mix(h, (Hash)cons->c_index),
+					(Hash)s[i]);
+			value = value->c_rest;
+			break;
+		}
+		case C_PAIR:
+			h = hash_value(value->c_left, h);
+			value = value->c_right;
+			break;
+		case C_ARRAY: {	/* as a list */
+			auto elts = value->c_block->a_elt + value->c_start;
+			for (int i = 0; i < value->c_size; i++)
+				h = hash_value(elts[i],
+					mix(h, (Hash)cons->c_index));
+			return mix(h, (Hash)nil->c_index);
+		}
+		case C_VECTOR: {
+			auto x = value->c_block->a_num + value->c_start;
+			for (int i = 0; i < value->c_size; i++)
+				h = mix(h, hash_num(x[i]));
+			return mix(h, (Hash)value->c_size);
+		}
+		case C_PAPP:	/* cf chk_argument() in interpret.c */
+			error(EXECERR, "attempt to hash functions");
+			return h;
+		default:
+			NOT_REACHED;
+		}
+	}
+}
+
+static Hash
+hash_num(Num n)
+{
+	unsigned char	bytes[sizeof(Num)];
+	Hash	h;
+
+	if (n == floor(n) && fabs(n) < 1e18)	/* including -0 */
+		return (Hash)(long long)n;
+	(void)memcpy(bytes, &n, sizeof(Num));
+	h = 0;
+	for (auto b : bytes)
+		h = mix(h, (Hash)b);
+	return h;
+}
+
+static Hash
+mix(Hash h, Hash x)
+{
+	h = (h ^ x) * 0x9e3779b97f4a7c15ULL;
+	return h ^ (h >> 29);
+}
+
+static Hash
+hash_function(Cell *fn)
+{
+	if (fn->c_class != C_PAPP)
+		return (Hash)fn;
+	return mix(mix((Hash)fn->c_expr, (Hash)fn->c_env),
+		   (Hash)fn->c_arity);
+}
+
+/* copies of one function value */
+static Bool
+same_function(Cell *f, Cell *g)
+{
+	if (f->c_class != C_PAPP || g->c_class != C_PAPP)
+		return f == g;
+	return f->c_expr == g->c_expr && f->c_env == g->c_env &&
+		f->c_arity == g->c_arity;
+}
@@ -0,0 +1,26 @@
+#ifndef HASH_H
+#define HASH_H
+
+/*
+ *	Hashing values, and tables of remembered results of functions.
+ */
+
+#include "defs.h"
+
+/*
+ *	The table of remembered results, a root for the garbage collector,
+ *	or NOCELL if it is empty.
+ */
+extern	Cell	*memo_table;
+
+/* Call after reading standard module. */
+extern	void	init_memo(void);
+
+/* forget all results, at the start of an evaluation */
+extern	void	clear_memo(void);
+
+/* the built-in functions */
+extern	Cell	*hash(Cell *value);
+extern	Cell	*memo_call(Cell *arg);
+
+#endif
@@ -24,6 +24,9 @@
 
 #define	NOCELL	(nullptr)
 
+/* no. of characters packed in a cell (cf value.h) */
+#define	STR_CHUNK	(sizeof(Cell *)/sizeof(SChar))
+
 struct _Cell {
 	char	c_class;
 	char	c_misc_num;		/* PAPP */
@@ -39,12 +42,17 @@ struct _Cell {
 				Path	cu_path;	/* DIRS */
 				UCase	*cu_code;	/* UCASE */
 				LCase	*cu_lcase;	/* LCASE */
+				SChar	cu_chars[STR_CHUNK];	/* STRING */
 			} co_union;
 			Cell	*cu_cell;
 		} cu_one;
 		struct {	/* binary nodes */
 			Cell	*cu_left, *cu_right;	/* PAIR */
 		} cu_two;
+		struct {	/* ARRAY, VECTOR */
+			Array	*cu_block;
+			int	cu_start, cu_size;
+		} cu_arr;
 	} c_union;
 };
 
@@ -64,4 +72,15 @@ extern	Cell	*new_cell(int c_class);
 extern	void	chk_heap(Cell *current, int required);
 extern	void	heap_stats(void);
 
+/*
+ *	Shared values of constant applicative forms (functions of arity 0)
+ *	caf_value(fn)	the value of fn, shared by all references.
+ *	keep_cafs()	call at the end of a successful evaluation, to
+ *			retain CAF values for later evaluations.
+ *	reset_cafs()	forget all CAF values.
+ */
+extern	Cell	*caf_value(Func *fn);
+extern	void	keep_cafs(void);
+extern	void	reset_cafs(void);
+
 #endif
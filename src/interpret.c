@@ -12,6 +12,7 @@
 #include "pr_value.h"
 #include "path.h"
 #include "stream.h"
+#include "strict.h"
 
 /*
  * The interpreter uses an extension of Krivine's machine.
@@ -46,7 +47,34 @@
  *   the the top of the stack, it indicates that the current value is
  *   to be evaluated to head normal form.  Thus if it is a constructor
  *   or pair, its sub-value(s) must also be forced.
+ * - another mark on the stack: EVAL_MARK.  When this is at the top of
+ *   the stack, the current value is in head normal form, and evaluation
+ *   continues with the next item on the stack.  It is used to evaluate
+ *   parts of an argument before a call to a function that is strict in
+ *   them (cf strict.c).
  * - Fetching a sub-part of an argument: DIR nodes (cf number.c, path.c).
+ * - Optimistic evaluation (the -o option): cheap expressions whose
+ *   operands are already evaluated are evaluated instead of being
+ *   suspended, under a budget of cells, with counters at each site to
+ *   give up on those where this usually fails (cf suspend()).
+ * - Trimmed environments: a suspension of an expression with no free
+ *   variables gets an empty environment, one of a variable refers to
+ *   its entry alone (cf ref_param()), and a lambda that uses only a
+ *   few near entries of its environment gets a copy of just those
+ *   (cf fv_expr() in number.c), so that closures do not keep alive
+ *   values they cannot use (cf trim()).
+ * - Single entries: a variable whose cell is certainly entered only
+ *   once enters it without an update frame (cf usage.c).
+ * - Stack squeezing: when a suspension is entered with an update frame
+ *   directly above another one, it is made an indirection to the cell
+ *   that frame will update, instead of pushing a second frame
+ *   (cf squeeze()).
+ * - Unboxed calls: a call building a tuple for a function that takes
+ *   it apart passes the parts directly to a worker (cf unbox.c).
+ * - Packed strings: a STRING cell is a run of characters of a list
+ *   (cf value.h).  It is in head normal form, and is only unpacked
+ *   into a CONS cell when it is matched, i.e. an LCASE is waiting for
+ *   it below any update frames.
  * - Pattern matching: CASE nodes (cf compile.c).
  */
 
@@ -60,14 +88,31 @@
 
 static void	run(Cell *current);
 static Cell	*take(Cell *current);
+static Cell	*squeeze(Cell *current);
+static Cell	*suspend(Expr *expr, Cell *env);
+static Cell	*trim(Natural used, Cell *env);
+static Cell	*ref_param(Expr *expr, Cell *env);
+static Cell	*speculate(Expr *expr, Cell *env, int *budget);
+static Cell	*spec_param(Expr *expr, Cell *env, int *budget);
+static Cell	*spec_num(Expr *expr, Cell *env, int *budget);
+static Cell	*under_updates(void);
+static Cell	*strict_arg(Expr *expr, Cell *env, int pos, int mask,
+			Cell **forced, int *nforced);
+static Cell	*unbox_args(Expr *shape, Expr *expr, Cell *env, int pos,
+			int mask, Cell **forced, int *nforced, Cell *args);
+static void	reset_sites(void);
 static void	chk_argument(Cell *arg);
 
 String	cur_function;	/* for error reporting */
 
+static	Expr	*e_once_var;	/* var 0, entered only once (cf ref_param()) */
+
 #define	NULL_ENV	NOCELL
 
-/* push an update frame and enter p */
-#define	EnterUpdate(p)	(current = (p), PushUpdate(current))
+/* push an update frame (or squeeze one) and enter p */
+#define	EnterUpdate(p)	(current = (p),\
+		IsUpdate() ? (void)(current = squeeze(current)) :\
+			(void)PushUpdate(current))
 
 /* force evaluation (and update) of p */
 #define	Force(p)	(Push(FORCE_MARK), EnterUpdate(p))
@@ -77,10 +122,26 @@ String	cur_function;	/* for error reporting */
  * the stream handler and the various builtins.  If any of these change,
  * these constants may also need to change.
  */
-#define	MAX_NEWS	4	/* max. no. of cells required by any step */
-#define	MAX_PUSHES	(2+2*UPD_FRAME)
+/* max. no. of cells built speculating on one suspension (cf suspend()) */
+#define	SPEC_BUDGET	4
+
+/* max. no. of parts of an argument evaluated before a call */
+#define	MAX_FORCED	(MAX_POS/2)
+
+/* max. no. of entries copied into the environment of a lambda (cf trim()) */
+#define	MAX_TRIM	8
+
+#define	MAX_NEWS	(1+MAX_FORCED*(SPEC_BUDGET+2)+MAX_FORCED)
+				/* max. no. of cells required by any step */
+				/* (including one for squeeze()), */
+				/* which is at least 1+MAX_TRIM, */
+				/* and covers an unboxed call */
+#define	MAX_PUSHES	(1+2*MAX_FORCED+UPD_FRAME)
 				/* max. amount of stack growth on any step */
 
+/* an empty path, for entering a cell from the stack */
+static	char	p_end[] = { P_END };
+
 /* #define MORE_STATS */
 #ifdef MORE_STATS
 static int	do_cell[C_NCLASSES];
@@ -88,6 +149,14 @@ static int	do_expr[E_NCLASSES];
 static int	do_dir[P_NCLASSES];
 #endif
 
+void
+init_interpret(void)
+{
+	e_once_var = dir_expr(p_new());
+	e_once_var->e_used = EnvBit(0);
+	e_once_var->e_once = TRUE;
+}
+
 /*
  *	Interpreter for an expression.
  *	See compile.c for the translation schemes.
@@ -104,11 +173,13 @@ interpret(Expr *action, Expr *expr)
 		do_dir[i] = 0;
 #endif
 	start_stack();
+	reset_sites();
 	enable_interrupt();
 	chk_stack(1);
 	Push(new_susp(expr, new_pair(new_stream(stdin), NULL_ENV)));
 	run(new_susp(action, NULL_ENV));
 	disable_interrupt();
+	keep_cafs();
 #ifdef MORE_STATS
 	for (int i = 0; i < C_NCLASSES; i++) {
 		int	j;
@@ -140,6 +211,32 @@ evaluate(Cell *value)
 	return Pop();
 }
 
+/*
+ *	Reduce a value to head normal form only, leaving its parts unevaluated
+ */
+Cell *
+head_evaluate(Cell *value)
+{
+	if (evaluated(value))
+		return value;
+	chk_stack(3 + UPD_FRAME);
+	Push(value);	/* so that it isn't forgotten */
+	chk_heap(NOCELL, 1);
+	Push(new_susp(e_return, NULL_ENV));
+	Push(EVAL_MARK);
+	PushUpdate(value);
+	run(value);
+	return Pop();
+}
+
+Cell *
+follow(Cell *value)
+{
+	while (value->c_class == C_IND)
+		value = value->c_ind;
+	return value;
+}
+
 static void
 run(Cell *current)
 {
@@ -161,6 +258,8 @@ run(Cell *current)
 	Expr	*expr; 		/* expression for suspensions */
 	UCase	*code;
 	LCase	*lcase;
+	Cell	*forced[MAX_FORCED];	/* parts of an argument to evaluate */
+	int	nforced;
 
     for(;;) {
 	chk_heap(current, MAX_NEWS);
@@ -179,23 +278,49 @@ run(Cell *current)
     case C_NUM:
 		SHOW("Num: "); SHOW2(NUMfmt, current->c_num); SHOW("\n");
 		top = take(current);
-		current = top == FORCE_MARK ? Pop() : top;
+		current = top == FORCE_MARK || top == EVAL_MARK ? Pop() : top;
         break;
     case C_CHAR:
 		SHOW2("CHAR: %c\n", current->c_char);
 		top = take(current);
-		current = top == FORCE_MARK ? Pop() : top;
+		current = top == FORCE_MARK || top == EVAL_MARK ? Pop() : top;
         break;
     case C_CONST:
 		SHOW2("CONST: %s\n", current->c_cons->c_name);
 		top = take(current);
-		current = top == FORCE_MARK ? Pop() : top;
+		current = top == FORCE_MARK || top == EVAL_MARK ? Pop() : top;
+        break;
+    case C_ARRAY:
+    case C_VECTOR:
+		SHOW("ARRAY\n");
+		/* the elements are left alone, even when forcing */
+		top = take(current);
+		current = top == FORCE_MARK || top == EVAL_MARK ? Pop() : top;
         break;
     case C_CONS:
 		SHOW2("CONS: %s\n", current->c_cons->c_name);
 		top = take(current);
 		if (top == FORCE_MARK)
 			Force(current->c_arg);
+		else if (top == EVAL_MARK)
+			current = Pop();
+		else	/* top is a normal value */
+			current = top;
+        break;
+    case C_STRING:
+		SHOW("STRING\n");
+		top = under_updates();
+		if (top != FORCE_MARK && top != EVAL_MARK &&
+		    top->c_class == C_LCASE) {
+			/* matched: continue as a CONS */
+			current = unpack_string(current);
+			break;
+		}
+		top = take(current);
+		if (top == FORCE_MARK)
+			Force(current->c_rest);
+		else if (top == EVAL_MARK)
+			current = Pop();
 		else	/* top is a normal value */
 			current = top;
         break;
@@ -208,9 +333,15 @@ run(Cell *current)
 			PushUpdate(tmp);
 			Push(tmp);
 			Force(current->c_left);
-		} else	/* top is a normal value */
+		} else if (top == EVAL_MARK)
+			current = Pop();
+		else	/* top is a normal value */
 			current = top;
         break;
+    case C_IND:
+		SHOW("IND\n");
+		current = current->c_ind;
+        break;
     case C_STREAM:
 		SHOW("STREAM\n");
 		current = read_stream(current);
@@ -257,16 +388,50 @@ run(Cell *current)
 		switch (expr->e_class) {
 		case expr_type::E_PAIR:
 			SHOW("PAIR\n");
-			current = new_pair(new_susp(expr->e_left, env),
-					   new_susp(expr->e_right, env));
+			current = new_pair(suspend(expr->e_left, env),
+					   suspend(expr->e_right, env));
             break;
         case expr_type::E_APPLY:
         case expr_type::E_IF:
         case expr_type::E_LET:
         case expr_type::E_WHERE:
 			SHOW("APPLY\n");
-			Push(new_susp(expr->e_arg, env));
-			current = new_susp(expr->e_func, env);
+			nforced = 0;
+			if (expr->e_unboxed) {
+				/*
+				 * Pass the parts of the tuple straight to
+				 * the worker of the function.
+				 */
+				code = expr->e_func->e_defun->f_worker->e_code;
+				current = new_ucase(code,
+					unbox_args(expr->e_func->e_defun->f_shape,
+						expr->e_arg, env,
+						1, expr->e_strict,
+						forced, &nforced, NULL_ENV));
+			} else if (expr->e_strict == 0) {
+				Push(suspend(expr->e_arg, env));
+				current = new_susp(expr->e_func, env);
+				break;
+			} else {
+				Push(strict_arg(expr->e_arg, env, 1,
+						expr->e_strict,
+						forced, &nforced));
+				current = new_susp(expr->e_func, env);
+			}
+			/*
+			 * The function is strict in some parts of the
+			 * argument: evaluate them first, each followed
+			 * by an EVAL_MARK, and then make the call.
+			 */
+			if (nforced > 0) {
+				Push(current);
+				while (--nforced > 0) {
+					Push(EVAL_MARK);
+					Push(new_dirs(p_end, forced[nforced]));
+				}
+				Push(EVAL_MARK);
+				EnterUpdate(forced[0]);
+			}
             break;
         case expr_type::E_RLET:
         case expr_type::E_RWHERE:
@@ -278,7 +443,7 @@ run(Cell *current)
 			 */
 			env = new_pair(new_susp(expr->e_arg, NULL_ENV), env);
 			env->c_left->c_env = env;
-			current = new_susp(expr->e_func->e_branch->br_expr,
+			current = new_susp(expr->e_func->e_branch->br_body,
 					env);
             break;
         case expr_type::E_MU:
@@ -298,14 +463,27 @@ run(Cell *current)
 			if (expr->e_defun->f_code == nullptr)
 				error(EXECERR, "%s: undefined name",
 					expr->e_defun->f_name);
-			current = new_papp(expr, NULL_ENV,
-					expr->e_defun->f_arity);
+			/*
+			 * A constant (other than return) is shared:
+			 * enter its value, updating it.
+			 */
+			if (expr->e_defun->f_arity == 0 &&
+			    expr->e_defun->f_code->uc_body->e_class !=
+					expr_type::E_RETURN)
+				EnterUpdate(caf_value(expr->e_defun));
+			else
+				current = new_papp(expr, NULL_ENV,
+						expr->e_defun->f_arity);
             break;
         case expr_type::E_LAMBDA:
-        case expr_type::E_EQN:
         case expr_type::E_PRESECT:
         case expr_type::E_POSTSECT:
 			SHOW("LAMBDA\n");
+			current = new_papp(expr, trim(expr->e_used, env),
+					expr->e_arity);
+            break;
+        case expr_type::E_EQN:	/* applied at once: no need to trim */
+			SHOW("EQN\n");
 			current = new_papp(expr, env, expr->e_arity);
             break;
         case expr_type::E_NUM:
@@ -329,7 +507,10 @@ run(Cell *current)
 			SHOW2("PARAM(%d)\n", expr->e_level);
 			for (var = expr->e_level; var > 0; var--)
 				env = env->c_right;
-			current = new_dirs(expr->e_where, env->c_left);
+			if (expr->e_once)	/* no update needed */
+				current = env->c_left;
+			else
+				current = new_dirs(expr->e_where, env->c_left);
             break;
         case expr_type::E_BUILTIN:
 			SHOW("BUILTIN\n");
@@ -354,6 +535,7 @@ run(Cell *current)
 			return;
         case expr_type::E_VAR:
         case expr_type::E_PLUS:
+        case expr_type::E_BANG:
         case expr_type::E_NCLASSES:
 			NOT_REACHED;
 		}
@@ -394,6 +576,7 @@ run(Cell *current)
             case expr_type::E_RETURN:
             case expr_type::E_NCLASSES:
             case expr_type::E_PLUS:
+            case expr_type::E_BANG:
             case expr_type::E_VAR:
             case expr_type::E_IF:
             case expr_type::E_MU:
@@ -410,7 +593,7 @@ run(Cell *current)
 			}
 		} else {
 			top = take(current);
-			if (top == FORCE_MARK)
+			if (top == FORCE_MARK || top == EVAL_MARK)
 				current = Pop();
 			else { /* top is a normal value */
 				chk_argument(top);
@@ -440,6 +623,13 @@ run(Cell *current)
 			tmp = env;
 			for (var = code->uc_level; var > 0; var--)
 				tmp = tmp->c_right;
+			if (code->uc_cases->lc_class == lc_type::LC_EVAL &&
+			    p_empty(code->uc_path) && evaluated(tmp->c_left)) {
+				/* a strict variable, already evaluated */
+				current = new_ucase(code->uc_cases->lc_limbs[0],
+						env);
+				break;
+			}
 			tmp = new_dirs(code->uc_path, tmp->c_left);
 			Push(tmp);		/* arg to LCASE or NCASE */
 			Push(new_lcase(code->uc_cases, env));
@@ -453,10 +643,17 @@ run(Cell *current)
 			SHOW("STRICT\n");
 			/* force the evaluation of var 0,
 			 * i.e the first element of the environment,
-			 * before continuing with the body (a built-in)
+			 * before continuing with the body (a built-in),
+			 * or just evaluate the part of it given (strict)
 			 */
 			Push(new_susp(code->uc_real, env));
-			Force(env->c_left);
+			if (code->uc_part == nullptr)
+				Force(env->c_left);
+			else {
+				Push(EVAL_MARK);
+				EnterUpdate(new_dirs(code->uc_part,
+						env->c_left));
+			}
             break;
 		}
         break;
@@ -483,6 +680,11 @@ run(Cell *current)
 			top = Pop();		/* arg (now updated) */
 			code = ca_index(lcase->lc_c_limbs, top->c_char);
             break;
+        case lc_type::LC_EVAL:
+			SHOW("EVAL\n");
+			(void)Pop();		/* arg (now updated) */
+			code = lcase->lc_limbs[0];
+            break;
 		}
 		current = new_ucase(code, env);
         break;
@@ -501,6 +703,363 @@ take(Cell *current)
 	return Pop();
 }
 
+/* the entry below the update frames on top of the stack */
+static Cell *
+under_updates(void)
+{
+	auto sp = stack;
+	for (auto frame = last_update; sp == frame; frame = frame->stk_update)
+		sp += UPD_FRAME;
+	return sp->stk_value;
+}
+
+/*
+ *	Optimistic evaluation.
+ *	Each expression that would be suspended is a site, with a credit
+ *	that is increased when speculation succeeds there, and decreased
+ *	when it fails.  Sites without credit are left alone, except that
+ *	they are retried every SPEC_RETRY times.  The credits are kept in
+ *	a small cache indexed by the address of the expression.
+ */
+#define	MAX_SITES	512	/* size of the cache of credits */
+#define	SPEC_CREDIT	4	/* initial credit */
+#define	MAX_CREDIT	16
+#define	SPEC_RETRY	64
+
+static struct {
+	Expr	*site;
+	short	credit;
+} sites[MAX_SITES];
+
+#define	SiteOf(expr)	(&sites[((size_t)(expr)/sizeof(Expr))%MAX_SITES])
+
+static void
+reset_sites(void)
+{
+	for (auto sp = sites; sp != &sites[MAX_SITES]; sp++)
+		sp->site = nullptr;
+}
+
+/*
+ *	Build a value for expr in env: a suspension, unless in optimistic
+ *	mode it can be cheaply evaluated at once.
+ *	Requires at most SPEC_BUDGET+1 free cells.
+ */
+static Cell *
+suspend(Expr *expr, Cell *env)
+{
+	Cell	*value;
+	int	budget;
+
+	if (expr->e_used == 0)	/* closed: keep no environment alive */
+		env = NULL_ENV;
+	if (! optimistic)
+		return expr->e_class == expr_type::E_PARAM ?
+			ref_param(expr, env) : new_susp(expr, env);
+	auto sp = SiteOf(expr);
+	if (sp->site != expr) {
+		sp->site = expr;
+		sp->credit = SPEC_CREDIT;
+	}
+	if (sp->credit <= 0) {
+		if (--sp->credit > -SPEC_RETRY)
+			return new_susp(expr, env);
+		sp->credit = 1;
+	}
+	budget = SPEC_BUDGET;
+	if ((value = speculate(expr, env, &budget)) == NOCELL) {
+		sp->credit -= 2;
+		return new_susp(expr, env);
+	}
+	/*
+	 * Don't share a variable's cell before it is evaluated: it may be
+	 * entered without an update (cf usage.c).
+	 */
+	if (expr->e_class == expr_type::E_PARAM && ! evaluated(value))
+		return ref_param(expr, env);
+	if (sp->credit < MAX_CREDIT)
+		sp->credit++;
+	return value;
+}
+
+/*
+ *	A variable, as a path into its own entry of env rather than a
+ *	suspension holding all of env, so that it keeps nothing else alive.
+ *	An entry used only here (cf usage.c) must still be entered without
+ *	an update, lest it hold on to its value, so that gets a suspension
+ *	with just that entry.
+ *	Requires at most 2 free cells.
+ */
+static Cell *
+ref_param(Expr *expr, Cell *env)
+{
+	for (auto var = expr->e_level; var > 0; var--)
+		env = env->c_right;
+	if (expr->e_once)
+		return new_susp(e_once_var, new_pair(env->c_left, NULL_ENV));
+	return new_dirs(expr->e_where, env->c_left);
+}
+
+/*
+ *	The environment for a closure using the entries used of env:
+ *	if these are few and near, a copy holding only them, with the
+ *	unused entries empty.
+ *	Requires at most MAX_TRIM free cells.
+ */
+static Cell *
+trim(Natural used, Cell *env)
+{
+	Cell	*entry[MAX_TRIM];
+	Cell	*copy;
+	int	n;
+	Bool	full;
+
+	if (used >= EnvBit(MAX_TRIM))
+		return env;
+	full = TRUE;
+	copy = env;
+	for (n = 0; (used >> n) != 0; n++) {
+		entry[n] = copy->c_left;
+		if ((used & EnvBit(n)) == 0)
+			full = FALSE;
+		copy = copy->c_right;
+	}
+	if (full && copy == NULL_ENV)	/* nothing to drop */
+		return env;
+	copy = NULL_ENV;
+	while (n-- > 0)
+		copy = new_pair((used & EnvBit(n)) != 0 ? entry[n] : NOCELL,
+				copy);
+	return copy;
+}
+
+/*
+ *	Build the argument expr (at position pos) of a call, adding to
+ *	forced the suspensions for the positions of mask (cf strict.c).
+ *	Requires at most MAX_FORCED*(SPEC_BUDGET+1) + MAX_FORCED-1 free cells.
+ */
+static Cell *
+strict_arg(Expr *expr, Cell *env, int pos, int mask,
+	   Cell **forced, int *nforced)
+{
+	if ((mask & StrictBit(pos)) == 0)
+		return suspend(expr, env);
+	if (expr->e_class == expr_type::E_PAIR) {
+		auto left = strict_arg(expr->e_left, env, 2*pos, mask,
+					forced, nforced);
+		return new_pair(left, strict_arg(expr->e_right, env, 2*pos+1,
+						mask, forced, nforced));
+	}
+	auto value = suspend(expr, env);
+	if (value->c_class == C_SUSP)
+		forced[(*nforced)++] = value;
+	return value;
+}
+
+/*
+ *	Add to args the parts of the argument expr (at position pos) of a
+ *	call at the leaves of shape, from left to right (cf unbox.c),
+ *	as strict_arg() would build them.
+ *	Requires the same free cells as strict_arg(), plus one per leaf.
+ */
+static Cell *
+unbox_args(Expr *shape, Expr *expr, Cell *env, int pos, int mask,
+	   Cell **forced, int *nforced, Cell *args)
+{
+	if (shape == nullptr)
+		return new_pair(strict_arg(expr, env, pos, mask,
+					forced, nforced), args);
+	args = unbox_args(shape->e_left, expr->e_left, env, 2*pos, mask,
+			forced, nforced, args);
+	return unbox_args(shape->e_right, expr->e_right, env, 2*pos+1, mask,
+			forced, nforced, args);
+}
+
+/*
+ *	Evaluate expr in env, if that can be done without entering any
+ *	suspension or risking an error, building at most *budget cells.
+ *	Otherwise return NOCELL.
+ */
+static Cell *
+speculate(Expr *expr, Cell *env, int *budget)
+{
+	Cell	*left, *right;
+	Expr	*func;
+
+	if (--*budget < 0)
+		return NOCELL;
+	switch (expr->e_class) {
+	case expr_type::E_NUM:
+		return new_num(expr->e_num);
+	case expr_type::E_CHAR:
+		return new_char(expr->e_char);
+	case expr_type::E_CONS:
+		return expr->e_const->c_nargs == 0 ?
+			new_cnst(expr->e_const) : NOCELL;
+	case expr_type::E_PARAM:
+		++*budget;	/* may not build anything */
+		return spec_param(expr, env, budget);
+	case expr_type::E_PAIR:
+		if ((left = speculate(expr->e_left, env, budget)) == NOCELL ||
+		    (right = speculate(expr->e_right, env, budget)) == NOCELL)
+			return NOCELL;
+		return new_pair(left, right);
+	case expr_type::E_APPLY:
+		func = expr->e_func;
+		if (func->e_class == expr_type::E_CONS &&
+		    func->e_const->c_nargs == 1) {
+			if ((left = speculate(expr->e_arg, env, budget)) ==
+					NOCELL)
+				return NOCELL;
+			return new_cons(func->e_const, left);
+		}
+		++*budget;
+		return spec_num(expr, env, budget);
+	default:
+		return NOCELL;
+	}
+}
+
+/*
+ *	A variable: the part of the environment it denotes, fetched
+ *	directly as far as its path leads through evaluated values.
+ */
+static Cell *
+spec_param(Expr *expr, Cell *env, int *budget)
+{
+	int	var;
+
+	for (var = expr->e_level; var > 0; var--)
+		env = env->c_right;
+	auto value = env->c_left;
+	for (auto path = expr->e_where; ; path = p_pop(path)) {
+		while (value->c_class == C_IND)
+			value = value->c_ind;
+		switch (p_top(path)) {
+		case P_END:
+			return value;
+		case P_UNROLL:
+			if (value->c_class != C_PAIR)
+				return --*budget < 0 ? NOCELL :
+					new_dirs(path, value);
+			break;
+		case P_LEFT:
+			value = value->c_left;
+			break;
+		case P_RIGHT:
+			value = value->c_right;
+			break;
+		case P_STRIP:
+			if (value->c_class != C_CONS)
+				return NOCELL;
+			value = value->c_arg;
+			break;
+		case P_PRED:
+			if (value->c_class != C_NUM || --*budget < 0)
+				return NOCELL;
+			value = new_num(value->c_num - 1);
+			break;
+		default:
+			NOT_REACHED;
+		}
+	}
+}
+
+/*
+ *	Arithmetic on evaluated numbers, using the built-in functions
+ *	defined with def_1math() and def_2math() (cf builtin.c).
+ *	A zero divisor is left for the real evaluation to report.
+ */
+static Cell *
+spec_num(Expr *expr, Cell *env, int *budget)
+{
+	Cell	*left, *right;
+
+	auto func = expr->e_func;
+	if (func->e_class != expr_type::E_DEFUN ||
+	    func->e_defun->f_code == nullptr ||
+	    func->e_defun->f_code->uc_class != uc_type::UC_STRICT)
+		return NOCELL;
+	auto real = func->e_defun->f_code->uc_real;
+	auto arg = expr->e_arg;
+	switch (real->e_class) {
+	case expr_type::E_BU_1MATH:
+		if ((left = speculate(arg, env, budget)) == NOCELL ||
+		    left->c_class != C_NUM || --*budget < 0)
+			return NOCELL;
+		return new_num((*(real->e_1math))(left->c_num));
+	case expr_type::E_BU_2MATH:
+		if (arg->e_class != expr_type::E_PAIR ||
+		    (left = speculate(arg->e_left, env, budget)) == NOCELL ||
+		    left->c_class != C_NUM ||
+		    (right = speculate(arg->e_right, env, budget)) == NOCELL ||
+		    right->c_class != C_NUM || right->c_num == Zero ||
+		    --*budget < 0)
+			return NOCELL;
+		return new_num((*(real->e_2math))(left->c_num, right->c_num));
+	default:
+		return NOCELL;
+	}
+}
+
+Bool
+evaluated(Cell *value)
+{
+	switch (value->c_class) {
+	case C_NUM:
+	case C_CHAR:
+	case C_CONST:
+	case C_ARRAY:
+	case C_VECTOR:
+	case C_CONS:
+	case C_STRING:
+	case C_PAIR:
+		return TRUE;
+	case C_PAPP:
+		return value->c_arity != 0;
+	default:
+		return FALSE;
+	}
+}
+
+/*
+ *	Stack squeezing.
+ *	The cell is to be entered with an update frame, but the frame on
+ *	top of the stack would be updated with the same value.  If the cell
+ *	is a suspended computation, it becomes an indirection to the cell
+ *	of that frame, and a copy of it is entered without a frame of its
+ *	own, so that tail calls through chains of suspensions run in
+ *	bounded stack.  The cell of the frame must be a black hole, i.e.
+ *	something that cannot be entered again before it is updated.
+ *	Otherwise the frame is pushed as usual.
+ *	Returns the cell to be entered.
+ */
+static Cell *
+squeeze(Cell *current)
+{
+	Cell	*copy;
+
+	switch (current->c_class) {
+	case C_PAPP:
+		if (current->c_arity != 0)
+			break;
+		/* fall through */
+	case C_SUSP:
+	case C_DIRS:
+	case C_UCASE:
+	case C_IND:
+		if (Updatee()->c_class != C_HOLE)
+			break;
+		copy = new_cell(current->c_class);
+		*copy = *current;
+		current->c_class = C_IND;
+		current->c_ind = Updatee();
+		return copy;
+	}
+	PushUpdate(current);
+	return current;
+}
+
 /*
  *	Desperate kludge to catch comparison of functions.
  *	Cf init_cmps() in compare.c
@@ -7,6 +7,9 @@
 /* name of most recently entered function, for error reporting */
 extern	String	cur_function;
 
+/* set up the expressions built into values by the interpreter */
+extern	void	init_interpret(void);
+
 /*
  *	Interpreter for an expression.
  *	See compile.c for the translation schemes.
@@ -18,4 +21,19 @@ extern	void	interpret(Expr *action, Expr *expr);
  */
 extern	Cell	*evaluate(Cell *value);
 
+/*
+ *	Reduce a value to head normal form only, leaving its parts
+ *	unevaluated
+ */
+extern	Cell	*head_evaluate(Cell *value);
+
+/*
+ *	An evaluated value, past any indirections left by its evaluation,
+ *	for walking over a structure evaluated earlier.
+ */
+extern	Cell	*follow(Cell *value);
+
+/* value is in head normal form, so entering it does no work */
+extern	Bool	evaluated(Cell *value);
+
 #endif
@@ -0,0 +1,264 @@
+#include "defs.h"
+#include "list.h"
+#include "array.h"
+#include "cons.h"
+#include "expr.h"
+#include "path.h"
+#include "value.h"
+#include "memory.h"
+#include "stack.h"
+#include "interpret.h"
+#include "error.h"
+#include "pr_value.h"
+
+/*
+ *	Native versions of functions of the list and lists modules
+ *	(cf lib/list.hop and lib/lists.hop), which are defined as these.
+ *	They evaluate the spine only as far as the functions they replace
+ *	would, and keep the elements as they are, unevaluated, except that
+ *	sum and product evaluate them all.
+ *	The loops keep only the current cell of a list on the stack, so
+ *	the cells already passed can be collected as they would have been.
+ */
+
+#define	MAX_COPY	256	/* max. elements copied by one call of front */
+
+static	char	p_end[] = { P_END };
+
+static Expr	*e_front;	/* list_front applied to var 0 */
+static String	n_front, n_after;
+
+static void	no_match(String name, Num n, Cell *xs);
+
+static Num	fold_nums(Cell *list, Num init, Binary *op);
+static Num	add(Num x, Num y);
+static Num	multiply(Num x, Num y);
+
+void
+init_list(void)
+{
+	auto fn = fn_lookup(newstring("list_front"));
+	ASSERT( fn != nullptr );
+	auto fn_expr = NEW(Expr);
+	fn_expr->e_class = expr_type::E_DEFUN;
+	fn_expr->e_used = ENV_ALL;
+	fn_expr->e_defun = fn;
+	e_front = apply_expr(fn_expr, dir_expr(p_new()));
+	n_front = newstring("front");
+	n_after = newstring("after");
+}
+
+/*
+ *	A count that does not reach 0: the call that would have failed to
+ *	match in the definition is reported, as for other failed matches.
+ */
+static void
+no_match(String name, Num n, Cell *xs)
+{
+	chk_heap(xs, 2);
+	pr_n_match(name, new_pair(new_num(n), xs));
+	error(EXECERR, "no match found");
+}
+
+Cell *
+list_length(Cell *list)
+{
+	long	n;
+
+	chk_stack(1);
+	Push(list);	/* the rest of the list */
+	n = 0;
+	for (;;) {
+		auto cp = head_evaluate(Top());
+		if (cp->c_class == C_STRING) {
+			n += cp->c_nchars;
+			Top() = cp->c_rest;
+		} else if (cp->c_class == C_CONS) {
+			n++;
+			Top() = head_evaluate(cp->c_arg)->c_right;
+		} else
+			break;
+	}
+	Pop_void();
+	return new_num((Num)n);
+}
+
+/* via an array, so the spine is evaluated before the copy is built */
+Cell *
+list_reverse(Cell *list)
+{
+	auto array = list2array(list);
+	chk_heap(array, ListCells(array->c_size));
+	auto elts = array->c_block->a_elt;
+	auto rev = new_cnst(nil);
+	for (int i = 0; i < array->c_size; i++)
+		rev = new_cons(cons, new_pair(elts[i], rev));
+	return rev;
+}
+
+Cell *
+list_sum(Cell *list)
+{
+	return new_num(fold_nums(list, Zero, add));
+}
+
+Cell *
+list_product(Cell *list)
+{
+	return new_num(fold_nums(list, (Num)1, multiply));
+}
+
+/*
+ *	Combine the elements with op from the left, starting with init.
+ *	(The definitions by foldr combined them from the right, which
+ *	gives the same result, except for rounding.)
+ */
+static Num
+fold_nums(Cell *list, Num init, Binary *op)
+{
+	auto acc = init;
+	chk_stack(1);
+	Push(list);	/* the rest of the list */
+	for (;;) {
+		auto cp = head_evaluate(Top());
+		if (cp->c_class != C_CONS)
+			break;
+		auto pair = head_evaluate(cp->c_arg);
+		acc = (*op)(acc, head_evaluate(pair->c_left)->c_num);
+		Top() = pair->c_right;
+	}
+	Pop_void();
+	return acc;
+}
+
+static Num
+add(Num x, Num y)
+{
+	return x + y;
+}
+
+static Num
+multiply(Num x, Num y)
+{
+	return x * y;
+}
+
+/*
+ *	front(n, xs): as far as the spine of xs is already evaluated (up to
+ *	MAX_COPY elements), its elements are copied at once, and the rest
+ *	of the result is a suspension of front on the rest of xs.
+ *	As in the definition, the count must reach 0 exactly.
+ */
+Cell *
+list_front(Cell *arg)
+{
+	Cell	*cp;
+	long	k;
+
+	chk_stack(1);
+	Push(arg);
+	auto n = head_evaluate(arg->c_left)->c_num;
+	if (n == Zero) {
+		Pop_void();
+		return new_cnst(nil);
+	}
+	if (! (n > Zero))
+		no_match(n_front, n, arg->c_right);
+	auto xs = head_evaluate(arg->c_right);
+	if (xs->c_class == C_CONS)
+		(void)head_evaluate(xs->c_arg);
+	/* count the elements to copy */
+	auto m = n;
+	k = 0;
+	for (cp = follow(arg->c_right); m > Zero && k < MAX_COPY; )
+		if (cp->c_class == C_STRING) {
+			for (int i = 0; i < cp->c_nchars && m > Zero; i++) {
+				m--;
+				k++;
+			}
+			if (m > Zero)
+				cp = follow(cp->c_rest);
+		} else if (cp->c_class == C_CONS &&
+			   follow(cp->c_arg)->c_class == C_PAIR) {
+			m--;
+			k++;
+			cp = follow(follow(cp->c_arg)->c_right);
+		} else
+			break;
+	/* 3 cells for each element (a character needs one), and the rest */
+	chk_heap(NOCELL, (int)(3*k + 5));
+	Cell	*result;
+	auto link = &result;
+	m = n;
+	for (cp = follow(arg->c_right); k > 0; )
+		if (cp->c_class == C_STRING) {
+			int	i;
+			for (i = 0; i < cp->c_nchars && k > 0; i++, k--, m--) {
+				auto elt = new_cons(cons,
+					new_pair(new_char(StrChars(cp)[i]),
+						 NOCELL));
+				*link = elt;
+				link = &elt->c_arg->c_right;
+			}
+			if (i == cp->c_nchars)
+				cp = follow(cp->c_rest);
+			else	/* the rest of the chunk */
+				cp = new_string(StrChars(cp) + i,
+						cp->c_nchars - i, cp->c_rest);
+		} else {
+			auto pair = follow(cp->c_arg);
+			auto elt = new_cons(cons, new_pair(pair->c_left, NOCELL));
+			*link = elt;
+			link = &elt->c_arg->c_right;
+			cp = follow(pair->c_right);
+			k--;
+			m--;
+		}
+	if (m == Zero || (m > Zero && cp->c_class == C_CONST))
+		*link = new_cnst(nil);
+	else
+		*link = new_susp(e_front,
+				new_pair(new_pair(new_num(m), cp), NOCELL));
+	Pop_void();
+	return result;
+}
+
+/*
+ *	after(n, xs): the spine of xs is evaluated as far as the count goes,
+ *	and the rest is entered with an update frame, as a variable would
+ *	be.
+ */
+Cell *
+list_after(Cell *arg)
+{
+	chk_stack(1);
+	Push(arg);
+	auto n = head_evaluate(arg->c_left)->c_num;
+	/* keep only the rest of the list, so the part passed can go */
+	Top() = follow(Top())->c_right;
+	while (n != Zero) {
+		auto cp = head_evaluate(Top());
+		if (cp->c_class == C_CONST)
+			break;
+		if (! (n > Zero))
+			no_match(n_after, n, cp);
+		if (cp->c_class == C_STRING) {
+			int	i;
+			for (i = 0; i < cp->c_nchars && n > Zero; i++)
+				n--;
+			if (i == cp->c_nchars)
+				Top() = cp->c_rest;
+			else {	/* the rest of the chunk */
+				chk_heap(NOCELL, 1);
+				Top() = new_string(StrChars(cp) + i,
+						cp->c_nchars - i, cp->c_rest);
+				if (n != Zero)
+					no_match(n_after, n, Top());
+			}
+		} else {
+			n--;
+			Top() = head_evaluate(cp->c_arg)->c_right;
+		}
+	}
+	return new_dirs(p_end, Pop());
+}
@@ -0,0 +1,21 @@
+#ifndef LIST_H
+#define LIST_H
+
+/*
+ *	Native versions of some functions of the list modules.
+ */
+
+#include "defs.h"
+
+/* Call after reading standard module. */
+extern	void	init_list(void);
+
+/* the built-in functions */
+extern	Cell	*list_length(Cell *list);
+extern	Cell	*list_reverse(Cell *list);
+extern	Cell	*list_sum(Cell *list);
+extern	Cell	*list_product(Cell *list);
+extern	Cell	*list_front(Cell *arg);
+extern	Cell	*list_after(Cell *arg);
+
+#endif
@@ -3,8 +3,10 @@
 #include "module.h"
 #include "source.h"
 #include "error.h"
+#include "output.h"
 #ifdef unix
 #include "plan9args.h"
+#include <limits.h>
 #endif
 
 #ifdef NLS
@@ -13,9 +15,18 @@
 
 Bool	restricted;	/* disable file I/O */
 int	time_limit;	/* evaluation time limit in seconds */
+Bool	optimistic;	/* speculate cheap suspensions */
+Bool	simplifying;	/* simplify expressions before compiling */
+int	stack_limit;	/* max. size of run-time stack in Kbytes */
 
 const	char	*const	*cmd_args;
 
+#ifdef unix
+static	const	char	usage[] = "usage: %s -lnor -f file -t nsecs -k kbytes\n";
+
+static int	kbytes(const char *arg);
+#endif
+
 int
 main(int argc, const char *const argv[])
 {
@@ -28,27 +39,38 @@ main(int argc, const char *const argv[])
 	script_file = nullptr;
 #endif
 	source_file = nullptr;
-	gen_listing = restricted = FALSE;
+	gen_listing = restricted = optimistic = FALSE;
+	simplifying = TRUE;
 	time_limit = 0;
+	stack_limit = DEF_STACK_LIMIT;
 #ifdef unix
 	ARGBEGIN {
 		case 'f': source_file = ARGF();
             break;
         case 'l': gen_listing = TRUE;
             break;
+        case 'n': simplifying = FALSE;
+            break;
+        case 'o': optimistic = TRUE;
+            break;
         case 'r': restricted = TRUE;
             break;
         case 't': time_limit = atoi(ARGF());
             break;
+        case 'k': stack_limit = kbytes(ARGF());
+            break;
 #ifdef RE_EDIT
         case 's': script_file = ARGF();
             break;
 #endif
         default:
-			fprintf(stderr, "usage: %s -lr -f file -t nsecs\n",
-				argv0);
+			fprintf(stderr, usage, argv0);
 			return 1;
 	} ARGEND
+	if (stack_limit <= 0) {
+		fprintf(stderr, usage, argv0);
+		return 1;
+	}
 	cmd_args = argv;
 #else
 	cmd_args = argv+1;
@@ -70,6 +92,7 @@ main(int argc, const char *const argv[])
 	init_memory();
 	init_strings();
 	init_lex();
+	init_output();
 	init_source(src, gen_listing);
 
 #ifdef RE_EDIT
@@ -101,3 +124,16 @@ restart(const char *script_file)
 	error(FATALERR, "cannot restart");
 }
 #endif
+
+#ifdef unix
+/* a positive whole number of Kbytes, or 0 if arg is not one */
+static int
+kbytes(const char *arg)
+{
+	char	*end;
+
+	auto n = strtol(arg, &end, 10);
+	return end != arg && *end == '\0' && n > 0 && n <= INT_MAX ?
+		(int)n : 0;
+}
+#endif
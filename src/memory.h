@@ -13,8 +13,6 @@
  *	|-----------------------| <-- base_table
  *	| temporary table space	|			t_alloc(n)
  *	|-----------------------| <-- base_temp
- *	| Run-time stack	|			Push(cell)
- *	|-----------------------| <-- stack
  *	|	   |		|
  *	|	   v		|
  *	|			|
@@ -30,6 +28,9 @@
  * There is also a pointer lim_temp, which is either equal to top_string
  * or, when the heap but not the stack is enabled, a fence between heap
  * and base_temp.
+ *
+ * The run-time stack (Push(cell)) is allocated separately, and grows
+ * as required (cf runtime.c).
  */
 
 extern	void	init_memory(void);	/* set up everything */
@@ -14,10 +14,17 @@
 #include "source.h"
 #include "builtin.h"
 #include "compare.h"
+#include "sort.h"
+#include "hash.h"
+#include "list.h"
+#include "vector.h"
+#include "text_fns.h"
+#include "interpret.h"
 #include "remember_type.h"
 #include "output.h"
 #include "pr_expr.h"
 #include "pr_type.h"
+#include "simplify.h"
 
 #define	MAX_MODULES	32	/* max. no. of modules (checked) */
 #define	MAX_TVARS	32	/* max. no. of type variables (checked) */
@@ -403,12 +410,19 @@ void
 mod_finish(void)
 {
 	auto current = *mod_current;
+	fuse_module(current->mod_name);
 	if (current->mod_num == STANDARD ||
 	    (current->mod_public != nullptr &&
 	     current->mod_public->mod_num == STANDARD)) {
 		check_type_defs();
 		alpha = tv_var((Natural)0);
 		init_cmps();
+		init_sort();
+		init_memo();
+		init_list();
+		init_vector();
+		init_text();
+		init_interpret();
 		init_builtins();
 		init_print();
 		init_argv();
@@ -839,6 +853,10 @@ new_fn(String name, QType *qtype)
 	fn->f_qtype = qtype;
 	fn->f_branch = nullptr;
 	fn->f_code = nullptr;
+	fn->f_value = nullptr;
+	fn->f_worker = nullptr;
+	fn->f_shape = nullptr;
+	(void)memset(fn->f_strict, 0, sizeof(fn->f_strict));
 	t_insert(&((*mod_current)->mod_fns), (TabElt *)fn);
 }
 
@@ -855,6 +873,10 @@ dec_functor(DefType *dt)
 	fn->f_tycons = dt;
 	fn->f_branch = nullptr;
 	fn->f_code = nullptr;
+	fn->f_value = nullptr;
+	fn->f_worker = nullptr;
+	fn->f_shape = nullptr;
+	(void)memset(fn->f_strict, 0, sizeof(fn->f_strict));
 	t_insert(&((*mod_current)->mod_fns), (TabElt *)fn);
 }
 
@@ -0,0 +1,33 @@
+#include "defs.h"
+#include "num.h"
+
+#define	WHOLE_LIMIT	1e15	/* 10^DBL_DIG: above this, NUMfmt uses exponents */
+
+/*
+ *	Format n as NUMfmt would, into buf (of at least NUM_SIZE bytes),
+ *	returning the length.  Whole numbers, by far the most common,
+ *	are converted directly rather than through printf.
+ */
+int
+fmt_num(char *buf, Num n)
+{
+	char	digits[NUM_SIZE];
+	char	*p;
+	unsigned long long	w;
+	int	len;
+
+	if (n != floor(n) || fabs(n) >= WHOLE_LIMIT || (n == 0 && signbit(n)))
+		return snprintf(buf, NUM_SIZE, NUMfmt, n);
+	p = digits + sizeof(digits);
+	w = (unsigned long long)fabs(n);
+	do {
+		*--p = (char)('0' + w%10);
+		w /= 10;
+	} while (w != 0);
+	if (n < 0)
+		*--p = '-';
+	len = (int)(digits + sizeof(digits) - p);
+	(void)memcpy(buf, p, len);
+	buf[len] = '\0';
+	return len;
+}
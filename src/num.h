@@ -14,6 +14,9 @@
 #define	NUMfmt	"%.*g", DBL_DIG
 #define	Zero	0.0
 
+#define	NUM_SIZE	32	/* enough for any number in NUMfmt */
+
 extern	Num	atoNUM(const char *s);
+extern	int	fmt_num(char *buf, Num n);
 
 #endif
@@ -136,6 +136,14 @@ nv_pattern(Expr *p, Path path)
 				path = p_push(P_PRED, path);
 			return nv_pattern(p->e_rest, path);
 		}
+		if (p->e_func->e_class == expr_type::E_VAR &&
+		    p->e_func->e_vname == newstring("$")) {
+			/* change to a BANG */
+			arg = p->e_arg;
+			p->e_class = expr_type::E_BANG;
+			p->e_rest = arg;
+			return nv_pattern(p->e_rest, path);
+		}
 		return nv_constructor(p, 0, &path);
     case expr_type::E_VAR:
 		if ((cp = cons_lookup(p->e_vname)) != nullptr &&
@@ -170,6 +178,7 @@ nv_pattern(Expr *p, Path path)
     case expr_type::E_RETURN:
     case expr_type::E_NCLASSES:
     case expr_type::E_PLUS:
+    case expr_type::E_BANG:
     case expr_type::E_IF:
     case expr_type::E_MU:
     case expr_type::E_LET:
@@ -245,6 +254,7 @@ nv_constructor(Expr *p, int level, Path *pathp)
     case expr_type::E_RETURN:
     case expr_type::E_NCLASSES:
     case expr_type::E_PLUS:
+    case expr_type::E_BANG:
     case expr_type::E_IF:
     case expr_type::E_MU:
     case expr_type::E_LET:
@@ -315,6 +325,7 @@ nv_expr(Expr *expr)
     case expr_type::E_RETURN:
     case expr_type::E_NCLASSES:
     case expr_type::E_PLUS:
+    case expr_type::E_BANG:
     case expr_type::E_DEFUN:
     case expr_type::E_PARAM:
 		NOT_REACHED;
@@ -344,6 +355,7 @@ nv_var(Expr *expr)
 	for (vp = next_var-1; vp >= base_var; vp--)
 		if ((*vp)->e_vname == name) {
 			expr->e_class = expr_type::E_PARAM;
+			expr->e_once = FALSE;
 			expr->e_patt = *vp;
 			for (def_level = base_level;
 			     *def_level <= vp;
@@ -366,3 +378,94 @@ nv_var(Expr *expr)
 	error(SEMERR, "%s: undefined variable", name);
 	return FALSE;
 }
+
+/*
+ *	Free variables.
+ */
+
+static Natural	fv_branches(Branch *branch, int arity);
+
+Natural
+fv_expr(Expr *expr)
+{
+	Natural	used;
+
+	used = 0;
+	switch (expr->e_class) {
+	case expr_type::E_NUM:
+	case expr_type::E_CHAR:
+	case expr_type::E_CONS:
+	case expr_type::E_DEFUN:
+	case expr_type::E_RETURN:
+		break;
+	case expr_type::E_PARAM:
+		used = EnvBit(expr->e_level);
+		break;
+	case expr_type::E_BUILTIN:
+	case expr_type::E_BU_1MATH:
+	case expr_type::E_BU_2MATH:
+		used = EnvBit(0);
+		break;
+	case expr_type::E_PAIR:
+		used = fv_expr(expr->e_left) | fv_expr(expr->e_right);
+		break;
+	case expr_type::E_APPLY:
+	case expr_type::E_IF:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+		used = fv_expr(expr->e_func) | fv_expr(expr->e_arg);
+		break;
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+		/* the definition and the body are both within its scope */
+		used = fv_branches(expr->e_func->e_branch, 0);
+		expr->e_func->e_used = fv_shift(used, 1);
+		used = fv_shift(used | fv_expr(expr->e_arg), 1);
+		break;
+	case expr_type::E_MU:
+		used = fv_shift(fv_expr(expr->e_body), 1);
+		break;
+	case expr_type::E_LAMBDA:
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		used = fv_branches(expr->e_branch, expr->e_arity);
+		break;
+	case expr_type::E_VAR:
+	case expr_type::E_PLUS:
+	case expr_type::E_BANG:
+	case expr_type::E_NCLASSES:
+		NOT_REACHED;
+	}
+	expr->e_used = used;
+	return used;
+}
+
+/*
+ * Entries used by the bodies, and by the originals kept for printing
+ * (cf simplify.c), as printing a function value shows its free variables.
+ */
+static Natural
+fv_branches(Branch *branch, int arity)
+{
+	Natural	used;
+
+	used = 0;
+	for ( ; branch != nullptr; branch = branch->br_next) {
+		used |= fv_expr(branch->br_body);
+		if (branch->br_expr != branch->br_body)
+			used |= fv_expr(branch->br_expr);
+	}
+	return fv_shift(used, arity);
+}
+
+/* entries used outside n further scopes */
+Natural
+fv_shift(Natural used, int n)
+{
+	if (n == 0)
+		return used;
+	if (used & ENV_FAR)
+		return (used >> n) | ~(ENV_ALL >> n);
+	return used >> n;
+}
@@ -9,4 +9,13 @@
 
 extern	Bool	nr_branch(Branch *branch);
 
+/*
+ *	Free variables: record in expr and its subexpressions the
+ *	environment entries each uses (cf e_used), returning those of expr.
+ */
+extern	Natural	fv_expr(Expr *expr);
+
+/* entries (as in e_used) used outside n further scopes */
+extern	Natural	fv_shift(Natural used, int n);
+
 #endif
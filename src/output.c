@@ -1,5 +1,5 @@
 /*
- *	The builtins "print" and "write_element".
+ *	The builtins "print", "write_element" and "write_list".
  */
 
 #include "defs.h"
@@ -14,15 +14,21 @@
 #include "memory.h"
 #include "error.h"
 
+#include <sys/stat.h>
+
 #define	STDOUT	stdout
 
 Expr	*e_return, *e_print, *e_wr_list;
+static	Expr	*e_wr_rest, *e_wr_cons;
+
+static	Bool	mid_print;	/* a result has been partly printed */
 
 void
 init_print(void)
 {
 	e_return = NEW(Expr);
     e_return->e_class = expr_type::E_RETURN;
+	e_return->e_used = ENV_ALL;
 	auto fn = fn_lookup(newstring("return"));
 	ASSERT( fn != nullptr );
 	fn->f_code = success(e_return, 0);
@@ -31,13 +37,27 @@ init_print(void)
 	ASSERT( fn != nullptr );
 	e_print = NEW(Expr);
 	e_print->e_class = expr_type::E_DEFUN;
+	e_print->e_used = ENV_ALL;
 	e_print->e_defun = fn;
 
 	fn = fn_lookup(newstring("write_list"));
 	ASSERT( fn != nullptr );
 	e_wr_list = NEW(Expr);
 	e_wr_list->e_class = expr_type::E_DEFUN;
+	e_wr_list->e_used = ENV_ALL;
 	e_wr_list->e_defun = fn;
+
+	/* write_list applied to var 0, and write_element x xs */
+	e_wr_rest = apply_expr(e_wr_list, dir_expr(p_new()));
+	fn = fn_lookup(newstring("write_element"));
+	ASSERT( fn != nullptr );
+	auto e_wr_elt = NEW(Expr);
+	e_wr_elt->e_class = expr_type::E_DEFUN;
+	e_wr_elt->e_used = ENV_ALL;
+	e_wr_elt->e_defun = fn;
+	e_wr_cons = apply_expr(
+			apply_expr(e_wr_elt, dir_expr(p_push(P_LEFT, p_new()))),
+			dir_expr(p_push(P_RIGHT, p_new())));
 }
 
 /*
@@ -47,42 +67,105 @@ Cell *
 print_value(Cell *value)
 {
 	(void)fprintf(STDOUT, ">> ");
+	mid_print = TRUE;
 	pr_value(STDOUT, value);
+	mid_print = FALSE;
 	(void)fprintf(STDOUT, " : ");
 	pr_ty_value(STDOUT, expr_type);
 	(void)fprintf(STDOUT, "\n");
 	return new_susp(e_return, NOCELL);
 }
 
+/*
+ *	The value is printed as it is evaluated, so an error may come
+ *	part way through: end the line before the error is reported.
+ */
+void
+end_print(void)
+{
+	if (mid_print) {
+		(void)fprintf(STDOUT, "\n");
+		(void)fflush(STDOUT);
+		mid_print = FALSE;
+	}
+}
+
 /*
  *	Direct a list-valued output to the terminal or a file
  */
 
+#define	OUT_BUFSIZE	65536	/* buffer for output to files and pipes */
+#define	MAX_FILENAME	1024	/* max. len. of output file name (checked) */
+#define	TEMP_SUFFIX	".XXXXXX"
+
 static FILE	*out_file;
-static const	char	*out_name;
+static const	char	*out_name;	/* nullptr for standard output */
+static char	out_temp[MAX_FILENAME + sizeof(TEMP_SUFFIX)];
+static char	out_buf[OUT_BUFSIZE];
 
-#define	TEMPFILE "TempFile"
+/*
+ *	Standard output is written in large blocks, unless it is a
+ *	terminal.  This must come before anything is written to it.
+ */
+void
+init_output(void)
+{
+	if (! isatty(fileno(STDOUT)))
+		(void)setvbuf(STDOUT, nullptr, _IOFBF, OUT_BUFSIZE);
+}
 
+/*
+ *	Output to a file goes to a new temporary file beside it, which
+ *	replaces the file (by renaming, so atomically) only when the
+ *	whole list has been written.  The old contents survive an error,
+ *	and simultaneous runs don't clobber each other's output.
+ */
 void
 open_out_file(const char *name)
 {
+	int	fd;
+	mode_t	mask;
+
+	out_name = nullptr;
 	if (restricted)
 		error(EXECERR, "file output disabled");
-	if (name == nullptr)
+	if (name == nullptr) {
 		out_file = STDOUT;
-	else if ((out_file = fopen(TEMPFILE, "w")) == nullptr)
-		error(EXECERR, "can't create temporary file");
+		return;
+	}
+	if (strlen(name) >= MAX_FILENAME)
+		error(EXECERR, "'%s': file name too long", name);
+	(void)snprintf(out_temp, sizeof(out_temp), "%s%s", name, TEMP_SUFFIX);
+	if ((fd = mkstemp(out_temp)) < 0)
+		error(EXECERR, "'%s': can't create file", name);
+	if ((out_file = fdopen(fd, "w")) == nullptr) {
+		(void)close(fd);
+		(void)remove(out_temp);
+		error(EXECERR, "'%s': can't create file", name);
+	}
+	/* mkstemp makes the file private: give it the usual permissions */
+	mask = umask(0);
+	(void)umask(mask);
+	(void)fchmod(fd, 0666 & ~mask);
+	(void)setvbuf(out_file, out_buf, _IOFBF, sizeof(out_buf));
 	out_name = name;
 }
 
 void
 save_out_file(void)
 {
+	Bool	failed;
+
 	if (out_name != nullptr) {
-		(void)fclose(out_file);
-		(void)remove(out_name);
-		/* (void)link(TEMPFILE, out_name); (void)unlink(TEMPFILE); */
-		(void)rename(TEMPFILE, out_name);
+		auto name = out_name;
+		out_name = nullptr;
+		failed = ferror(out_file) != 0;
+		if (fclose(out_file) != 0)
+			failed = TRUE;
+		if (failed || rename(out_temp, name) != 0) {
+			(void)remove(out_temp);
+			error(EXECERR, "'%s': can't write file", name);
+		}
 	}
 }
 
@@ -91,7 +174,8 @@ close_out_file(void)
 {
 	if (out_name != nullptr) {
 		(void)fclose(out_file);
-		(void)remove(TEMPFILE);
+		(void)remove(out_temp);
+		out_name = nullptr;
 	}
 }
 
@@ -106,3 +190,34 @@ write_value(Cell *value)
 	}
 	return new_susp(e_wr_list, NOCELL);
 }
+
+/*
+ *	Write a list, evaluated to head normal form: characters already
+ *	evaluated, including packed strings, are written at once, as far
+ *	as the list is evaluated, and the rest is left to write_list
+ *	again, or to write_element.
+ */
+Cell *
+write_list(Cell *list)
+{
+	for (;;)
+		switch (list->c_class) {
+		case C_CONST:	/* nil */
+			return new_susp(e_return, NOCELL);
+		case C_STRING:
+			for (int i = 0; i < list->c_nchars; i++)
+				PutChar(StrChars(list)[i], out_file);
+			list = list->c_rest;
+			break;
+		case C_CONS:
+			if (list->c_arg->c_class != C_PAIR ||
+			    list->c_arg->c_left->c_class != C_CHAR)
+				return new_susp(e_wr_cons,
+						new_pair(list->c_arg, NOCELL));
+			PutChar(list->c_arg->c_left->c_char, out_file);
+			list = list->c_arg->c_right;
+			break;
+		default:	/* not evaluated yet */
+			return new_susp(e_wr_rest, new_pair(list, NOCELL));
+		}
+}
@@ -2,7 +2,7 @@
 #define OUTPUT_H
 
 /*
- *	The builtins "print" and "write_element".
+ *	The builtins "print", "write_element" and "write_list".
  */
 
 #include "defs.h"
@@ -16,14 +16,21 @@ extern	void	init_print(void);
  */
 extern	Cell	*print_value(Cell *value);
 
+/*
+ *	End a line left partly printed by an error
+ */
+extern	void	end_print(void);
+
 /*
  *	Direct a list-valued output to the terminal or a file
  */
 
+extern	void	init_output(void);
 extern	void	open_out_file(const char *name);
 extern	void	save_out_file(void);
 extern	void	close_out_file(void);
 
 extern	Cell	*write_value(Cell *value);
+extern	Cell	*write_list(Cell *list);
 
 #endif
@@ -183,6 +183,10 @@ pr_c_expr(FILE *f, Expr *expr, int level, int context)
 		pr_c_expr(f, expr->e_rest, level, prec);
 		(void)fprintf(f, " + %d", expr->e_incr);
         break;
+    case expr_type::E_BANG:
+		(void)fprintf(f, "$ ");
+		pr_c_expr(f, expr->e_rest, level, PREC_ARG);
+        break;
     case expr_type::E_VAR:
 		(void)fprintf(f, "%s", expr->e_vname);
         break;
@@ -378,6 +382,7 @@ expr_name(Expr *expr, int level)
     case expr_type::E_NUM:
     case expr_type::E_CHAR:
     case expr_type::E_PAIR:
+    case expr_type::E_BANG:
     case expr_type::E_RLET:
     case expr_type::E_APPLY:
     case expr_type::E_WHERE:
@@ -428,6 +433,8 @@ precedence(Expr *expr)
 			return PREC_ATOMIC;
     case expr_type::E_PLUS:
 		return op_lookup(newstring("+"))->op_prec;
+    case expr_type::E_BANG:
+		return PREC_APPLY;
     case expr_type::E_VAR:
 		if (op_lookup(expr->e_vname) != nullptr)
 			return PREC_INFIX;
@@ -1,5 +1,5 @@
 /*
- *	Printing of computed values (fully evaluated)
+ *	Printing of computed values, evaluating them as they are printed
  */
 
 #include "defs.h"
@@ -7,6 +7,7 @@
 #include "expr.h"
 #include "cons.h"
 #include "value.h"
+#include "array.h"
 #include "stack.h"
 #include "path.h"
 #include "op.h"
@@ -15,19 +16,32 @@
 #include "pr_expr.h"
 #include "error.h"
 #include "names.h"
+#include "source.h"
 
 #define	set_env(e)	(chk_stack(1), Push(e))
 #define	cur_env()	Top()
 #define	clr_env()	Pop_void()
 
+/* limit on nesting of recursive calls, to protect the C stack */
+#define	MAX_DEPTH	10000
+
+/*
+ * Reset at each entry point below: a printing may have been abandoned
+ * by an error, and a failed match is reported just before one.
+ */
+static	int	depth;
+
 static void	safe_pr_value(FILE *f, Cell *value, int context);
 static void	real_pr_value(FILE *f, Cell *value, int context);
 static void	pr_vlist(FILE *f, Cell *value);
-static Bool	is_vlist(Cell *value);
-static Bool	is_vstring(Cell *value);
+static void	pr_array(FILE *f, Cell *value);
+static void	pr_vector(FILE *f, Cell *value);
+static Cell	*pr_eval(FILE *f, Cell *value);
 static Cell	*get_actual(int level, Path path);
-static void	safe_pr_f_value(FILE *f, String name, Cell *arg, int context);
-static void	pr_f_value(FILE *f, String name, int nargs, Cell *arg, int context);
+static void	safe_pr_f_value(FILE *f, String name, int nargs, Cell *arg,
+			int context);
+static Cell	*pr_f_value(FILE *f, String name, int nargs, Cell *arg,
+			int *context, int *parens);
 static void	pr_papp(FILE *f, Expr *expr, Cell *env, int nargs, int context);
 static void	pr_f_papp(FILE *f, String name, Cell *env, int nargs, int context);
 static int	prec_value(Cell *value);
@@ -35,20 +49,33 @@ static int	prec_value(Cell *value);
 void
 pr_value(FILE *f, Cell *value)
 {
+	depth = 0;
 	safe_pr_value(f, value, PREC_BODY);
 }
 
 void
 pr_f_match(Func *defun, Cell *env)
 {
+	depth = 0;
 	start_err_line();
 	pr_f_papp(errout, defun->f_name, env, defun->f_arity, PREC_BODY);
 	(void)fprintf(errout, "\n");
 }
 
+/* as pr_f_match(), for a native version of a function (cf list.c) */
+void
+pr_n_match(String name, Cell *arg)
+{
+	depth = 0;
+	start_err_line();
+	safe_pr_f_value(errout, name, 1, arg, PREC_BODY);
+	(void)fprintf(errout, "\n");
+}
+
 void
 pr_l_match(Expr *func, Cell *env)
 {
+	depth = 0;
 	start_err_line();
 	if (func->e_class == expr_type::E_EQN) {
 		pr_c_expr(errout, func->e_branch->br_formals->e_arg,
@@ -61,103 +88,136 @@ pr_l_match(Expr *func, Cell *env)
 }
 
 /*
- *	Print a value.
+ *	Print a value, in head normal form.
  *	The value is first pushed on the stack, so that it isn't treated
- *	as garbage.
+ *	as garbage.  Its parts are evaluated as they are reached (cf
+ *	pr_eval()), each pushed in turn, so that output begins at once.
+ *	A list is printed by moving its entry on the stack along it, so
+ *	that the part already printed can be reclaimed.  Likewise the last
+ *	component of a tuple or constructor is printed by moving along to
+ *	it, rather than by recursion, so that a value nested arbitrarily
+ *	deeply on the right (e.g. an infinite tuple) can be printed.
+ *	Other nesting is limited by MAX_DEPTH.
  */
 static void
 safe_pr_value(FILE *f, Cell *value, int context)
 {
+	if (++depth > MAX_DEPTH)
+		error(EXECERR, "value too deeply nested to print");
 	chk_stack(1);
 	Push(value);
 	real_pr_value(f, value, context);
 	Pop_void();
+	depth--;
 }
 
 static void
 real_pr_value(FILE *f, Cell *value, int context)
 {
-	auto prec = prec_value(value);
-	if (prec < context)
-		(void)fprintf(f, "(");
-	switch (value->c_class) {
-	case C_NUM:
-		(void)fprintf(f, NUMfmt, value->c_num);
-        break;
-    case C_CHAR:
-		(void)fprintf(f, "'");
-		pr_char(f, value->c_char);
-		(void)fprintf(f, "'");
-        break;
-    case C_CONST:
-		(void)fprintf(f, "%s", value->c_cons->c_name);
-        break;
-    case C_CONS:
-		if (is_vlist(value))
+	char	numbuf[NUM_SIZE];
+	int	parens = 0;
+
+	for (;;) {
+		auto prec = prec_value(value);
+		if (prec < context) {
+			(void)fprintf(f, "(");
+			parens++;
+		}
+		switch (value->c_class) {
+		case C_NUM:
+			(void)fwrite(numbuf, 1, fmt_num(numbuf, value->c_num), f);
+			break;
+		case C_CHAR:
+			(void)fprintf(f, "'");
+			pr_char(f, value->c_char);
+			(void)fprintf(f, "'");
+			break;
+		case C_CONST:
+			(void)fprintf(f, "%s", value->c_cons->c_name);
+			break;
+		case C_STRING:
 			pr_vlist(f, value);
-		else
-			pr_f_value(f, value->c_cons->c_name,
-				value->c_cons->c_nargs,
-				value->c_arg, InnerPrec(prec, context));
-        break;
-    case C_PAIR:
-		real_pr_value(f, value->c_left, PREC_COMMA+1);
-		(void)fprintf(f, ", ");
-		real_pr_value(f, value->c_right, PREC_COMMA);
-        break;
-    case C_SUSP:
-		set_env(value->c_env);
-		pr_c_expr(f, value->c_expr, 0, InnerPrec(prec, context));
-		clr_env();
-        break;
-    case C_PAPP:
-		switch (value->c_expr->e_class) {
-		case expr_type::E_DEFUN:
-			pr_f_papp(f, value->c_expr->e_defun->f_name,
-				value->c_env,
-				value->c_expr->e_defun->f_arity -
-					value->c_arity,
-				InnerPrec(prec, context));
-            break;
-        case expr_type::E_CONS:
-			pr_f_papp(f, value->c_expr->e_const->c_name,
-				value->c_env,
-				value->c_expr->e_const->c_nargs -
-					value->c_arity,
-				InnerPrec(prec, context));
-            break;
-        case expr_type::E_BU_1MATH:
-        case expr_type::E_BU_2MATH:
-        case expr_type::E_BUILTIN:
-        case expr_type::E_RETURN:
-        case expr_type::E_NCLASSES:
-        case expr_type::E_PLUS:
-        case expr_type::E_VAR:
-        case expr_type::E_IF:
-        case expr_type::E_MU:
-        case expr_type::E_LET:
-        case expr_type::E_NUM:
-        case expr_type::E_CHAR:
-        case expr_type::E_PARAM:
-        case expr_type::E_PAIR:
-        case expr_type::E_RLET:
-        case expr_type::E_APPLY:
-        case expr_type::E_WHERE:
-        case expr_type::E_RWHERE:
-        case expr_type::E_EQN:
-        case expr_type::E_LAMBDA:
-        case expr_type::E_PRESECT:
-        case expr_type::E_POSTSECT:
-        /* LAMBDA and the like */
-			pr_papp(f, value->c_expr, value->c_env,
-				value->c_expr->e_arity - value->c_arity,
-				InnerPrec(prec, context));
+			break;
+		case C_ARRAY:
+			pr_array(f, value);
+			break;
+		case C_VECTOR:
+			pr_vector(f, value);
+			break;
+		case C_CONS:
+			if (value->c_cons == cons) {
+				pr_vlist(f, value);
+				break;
+			}
+			context = InnerPrec(prec, context);
+			Top() = pr_eval(f, value->c_arg);
+			value = pr_f_value(f, value->c_cons->c_name,
+				value->c_cons->c_nargs, Top(), &context, &parens);
+			Top() = value;
+			continue;
+		case C_PAIR:
+			safe_pr_value(f, pr_eval(f, value->c_left), PREC_COMMA+1);
+			(void)fprintf(f, ", ");
+			value = pr_eval(f, value->c_right);
+			Top() = value;
+			context = PREC_COMMA;
+			continue;
+		case C_SUSP:
+			set_env(value->c_env);
+			pr_c_expr(f, value->c_expr, 0, InnerPrec(prec, context));
+			clr_env();
+			break;
+		case C_PAPP:
+			switch (value->c_expr->e_class) {
+			case expr_type::E_DEFUN:
+				pr_f_papp(f, value->c_expr->e_defun->f_name,
+					value->c_env,
+					value->c_expr->e_defun->f_arity -
+						value->c_arity,
+					InnerPrec(prec, context));
+				break;
+			case expr_type::E_CONS:
+				pr_f_papp(f, value->c_expr->e_const->c_name,
+					value->c_env,
+					value->c_expr->e_const->c_nargs -
+						value->c_arity,
+					InnerPrec(prec, context));
+				break;
+			case expr_type::E_BU_1MATH:
+			case expr_type::E_BU_2MATH:
+			case expr_type::E_BUILTIN:
+			case expr_type::E_RETURN:
+			case expr_type::E_NCLASSES:
+			case expr_type::E_PLUS:
+			case expr_type::E_BANG:
+			case expr_type::E_VAR:
+			case expr_type::E_IF:
+			case expr_type::E_MU:
+			case expr_type::E_LET:
+			case expr_type::E_NUM:
+			case expr_type::E_CHAR:
+			case expr_type::E_PARAM:
+			case expr_type::E_PAIR:
+			case expr_type::E_RLET:
+			case expr_type::E_APPLY:
+			case expr_type::E_WHERE:
+			case expr_type::E_RWHERE:
+			case expr_type::E_EQN:
+			case expr_type::E_LAMBDA:
+			case expr_type::E_PRESECT:
+			case expr_type::E_POSTSECT:
+			/* LAMBDA and the like */
+				pr_papp(f, value->c_expr, value->c_env,
+					value->c_expr->e_arity - value->c_arity,
+					InnerPrec(prec, context));
+			}
+			break;
+		default:
+			NOT_REACHED;
 		}
-        break;
-    default:
-		NOT_REACHED;
+		break;
 	}
-	if (prec < context)
+	while (parens-- > 0)
 		(void)fprintf(f, ")");
 }
 
@@ -188,7 +248,7 @@ pr_f_papp(FILE *f, String name, Cell *env, int nargs, int context)
 		else
 			(void)fprintf(f, "%s", name);
 	else if (nargs == 1)
-		safe_pr_f_value(f, name, evaluate(env->c_left), context);
+		safe_pr_f_value(f, name, 1, evaluate(env->c_left), context);
 	else {
 		if (PREC_APPLY < context)
 			(void)fprintf(f, "(");
@@ -201,23 +261,39 @@ pr_f_papp(FILE *f, String name, Cell *env, int nargs, int context)
 }
 
 /*
- * Print the value, which has been forced, and is known to be a non-empty list.
+ * Print the value, a non-empty list on top of the stack, as a string if
+ * its first element is a character.
  */
 static void
 pr_vlist(FILE *f, Cell *value)
 {
-	if (is_vstring(value)) {
+	if (value->c_class == C_STRING ||
+	    pr_eval(f, pr_eval(f, value->c_arg)->c_left)->c_class == C_CHAR) {
 		(void)fprintf(f, "\"");
-		for ( ; value->c_class == C_CONS;
-		     value = value->c_arg->c_right)
-			pr_char(f, value->c_arg->c_left->c_char);
+		for (;;) {
+			if (value->c_class == C_STRING) {
+				for (int i = 0; i < value->c_nchars; i++)
+					pr_char(f, StrChars(value)[i]);
+				value = value->c_rest;
+			} else if (value->c_class == C_CONS) {
+				auto arg = pr_eval(f, value->c_arg);
+				pr_char(f, pr_eval(f, arg->c_left)->c_char);
+				value = arg->c_right;
+			} else
+				break;
+			value = pr_eval(f, value);
+			Top() = value;
+		}
 		(void)fprintf(f, "\"");
 	} else {
 		(void)fprintf(f, "[");
-		for(;;) {
-			real_pr_value(f, value->c_arg->c_left, PREC_COMMA+1);
-			value = value->c_arg->c_right;
-		if(value->c_class == C_CONST) break;
+		for (;;) {
+			auto arg = pr_eval(f, value->c_arg);
+			safe_pr_value(f, pr_eval(f, arg->c_left), PREC_COMMA+1);
+			value = pr_eval(f, arg->c_right);
+			Top() = value;
+			if (value->c_class != C_CONS)
+				break;
 			(void)fprintf(f, ", ");
 		}
 		(void)fprintf(f, "]");
@@ -225,28 +301,66 @@ pr_vlist(FILE *f, Cell *value)
 }
 
 /*
- * Is the value, which has been forced, a list?
+ * Print an array, on top of the stack, as a conversion from a list.
  */
-static Bool
-is_vlist(Cell *value)
+static void
+pr_array(FILE *f, Cell *value)
 {
-	while (value->c_class == C_CONS && value->c_cons == cons)
-		value = value->c_arg->c_right;
-	return value->c_class == C_CONST && value->c_cons == nil;
+	auto elts = value->c_block->a_elt + value->c_start;
+	(void)fprintf(f, "list2array ");
+	if (value->c_size == 0)
+		(void)fprintf(f, "%s", nil->c_name);
+	else if (pr_eval(f, elts[0])->c_class == C_CHAR) {
+		(void)fprintf(f, "\"");
+		for (int i = 0; i < value->c_size; i++)
+			pr_char(f, pr_eval(f, elts[i])->c_char);
+		(void)fprintf(f, "\"");
+	} else {
+		(void)fprintf(f, "[");
+		for (int i = 0; i < value->c_size; i++) {
+			if (i > 0)
+				(void)fprintf(f, ", ");
+			safe_pr_value(f, pr_eval(f, elts[i]), PREC_COMMA+1);
+		}
+		(void)fprintf(f, "]");
+	}
 }
 
 /*
- * Is the value, which has been forced and is known to be a list, a string?
+ * Print a vector as a conversion from a list.
  */
-static Bool
-is_vstring(Cell *value)
+static void
+pr_vector(FILE *f, Cell *value)
 {
-	while (value->c_class == C_CONS) {
-		if (value->c_arg->c_left->c_class != C_CHAR)
-			return FALSE;
-		value = value->c_arg->c_right;
+	char	numbuf[NUM_SIZE];
+
+	auto elts = value->c_block->a_num + value->c_start;
+	(void)fprintf(f, "list2vector ");
+	if (value->c_size == 0)
+		(void)fprintf(f, "%s", nil->c_name);
+	else {
+		(void)fprintf(f, "[");
+		for (int i = 0; i < value->c_size; i++) {
+			if (i > 0)
+				(void)fprintf(f, ", ");
+			(void)fwrite(numbuf, 1, fmt_num(numbuf, elts[i]), f);
+		}
+		(void)fprintf(f, "]");
 	}
-	return TRUE;
+}
+
+/*
+ * A part of a value being printed, evaluated to head normal form.
+ * In an interactive session, what is printed so far is shown first.
+ */
+static Cell *
+pr_eval(FILE *f, Cell *value)
+{
+	if (evaluated(value))
+		return value;
+	if (f == stdout && interactive())
+		(void)fflush(f);
+	return head_evaluate(value);
 }
 
 static Cell *
@@ -270,47 +384,60 @@ pr_actual(FILE *f, int level, Path path, int context)
 void
 pr_f_actual(FILE *f, String name, int level, Path path, int context)
 {
-	safe_pr_f_value(f, name, get_actual(level, path), context);
+	safe_pr_f_value(f, name, 1, get_actual(level, path), context);
 }
 
 static void
-safe_pr_f_value(FILE *f, String name, Cell *arg, int context)
+safe_pr_f_value(FILE *f, String name, int nargs, Cell *arg, int context)
 {
+	int	parens = 0;
+
+	if (++depth > MAX_DEPTH)
+		error(EXECERR, "value too deeply nested to print");
 	chk_stack(1);
 	Push(arg);
-	pr_f_value(f, name, 1, arg, context);
+	Top() = pr_f_value(f, name, nargs, arg, &context, &parens);
+	real_pr_value(f, Top(), context);
+	while (parens-- > 0)
+		(void)fprintf(f, ")");
 	Pop_void();
+	depth--;
 }
 
-static void
-pr_f_value(FILE *f, String name, int nargs, Cell *arg, int context)
-		/* a constructor arg is actually several */
+/*
+ * Print a constructor or function applied to arg (a constructor arg is
+ * actually several), except for its last component, which is returned,
+ * to be printed in *context and followed by *parens closing parentheses.
+ */
+static Cell *
+pr_f_value(FILE *f, String name, int nargs, Cell *arg, int *context,
+	int *parens)
 {
 	auto op = op_lookup(name);
 
 	if (op != nullptr) {
 		if (arg->c_class == C_PAIR) {
-			if (op->op_prec < context)
+			if (op->op_prec < *context) {
 				(void)fprintf(f, "(");
-			real_pr_value(f, arg->c_left, LeftPrec(op));
+				++*parens;
+			}
+			safe_pr_value(f, pr_eval(f, arg->c_left), LeftPrec(op));
 			(void)fprintf(f, " %s ", name);
-			real_pr_value(f, arg->c_right, RightPrec(op));
-			if (op->op_prec < context)
-				(void)fprintf(f, ")");
-		} else {
-			(void)fprintf(f, "(%s) ", name);
-			real_pr_value(f, arg, PREC_ARG);
+			*context = RightPrec(op);
+			return pr_eval(f, arg->c_right);
 		}
+		(void)fprintf(f, "(%s) ", name);
 	} else {
 		(void)fprintf(f, "%s", name);
 		while (nargs-- > 1) {
 			(void)fprintf(f, " ");
-			real_pr_value(f, arg->c_left, PREC_ARG);
-			arg = arg->c_right;
+			safe_pr_value(f, pr_eval(f, arg->c_left), PREC_ARG);
+			arg = pr_eval(f, arg->c_right);
 		}
 		(void)fprintf(f, " ");
-		real_pr_value(f, arg, PREC_ARG);
 	}
+	*context = PREC_ARG;
+	return arg;
 }
 
 String
@@ -330,6 +457,7 @@ val_name(int level, Path path)
         case expr_type::E_RETURN:
         case expr_type::E_NCLASSES:
         case expr_type::E_PLUS:
+        case expr_type::E_BANG:
         case expr_type::E_VAR:
         case expr_type::E_IF:
         case expr_type::E_MU:
@@ -368,6 +496,9 @@ prec_value(Cell *value)
     case C_CONST:
 		return PREC_ATOMIC;
     case C_CONS:
+    case C_STRING:
+    case C_ARRAY:
+    case C_VECTOR:
 		return PREC_APPLY;
     case C_PAPP:
 		switch (value->c_expr->e_class) {
@@ -387,6 +518,7 @@ prec_value(Cell *value)
         case expr_type::E_RETURN:
         case expr_type::E_NCLASSES:
         case expr_type::E_PLUS:
+        case expr_type::E_BANG:
         case expr_type::E_VAR:
         case expr_type::E_IF:
         case expr_type::E_MU:
@@ -2,7 +2,7 @@
 #define PR_VALUE_H
 
 /*
- *	Printing of computed values (fully evaluated)
+ *	Printing of computed values, evaluating them as they are printed
  */
 
 #include "defs.h"
@@ -12,6 +12,7 @@
 extern	void	pr_value(FILE *f, Cell *value);
 
 extern	void	pr_f_match(Func *defun, Cell *env);
+extern	void	pr_n_match(String name, Cell *arg);
 extern	void	pr_l_match(Expr *func, Cell *env);
 
 /*
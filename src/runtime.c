@@ -1,26 +1,34 @@
 #include "defs.h"
 #include "heap.h"
+#include "value.h"
+#include "array.h"
+#include "hash.h"
 #include "stack.h"
 #include "memory.h"
 #include "type_check.h"
+#include "expr.h"
 #include "error.h"
 
 /* define this to get various statistics */
 /* #define STATS */
 
 /*
- *	These two constants give the ratio between stack and heap used
- *	when the run-time space is divided up.  Adjust to taste.
+ *	The run-time stack is not part of the memory area of memory.c,
+ *	which is used entirely for the heap during evaluation.
+ *	Instead it has its own block, which grows downwards from TopStack,
+ *	and is reallocated at twice the size when full (cf grow_stack()),
+ *	up to a limit set with the -k option.
  */
-#define	STACK	1
-#define	HEAP	5
+#define	INIT_STACK	4096	/* initial size of stack (no. of elements) */
 
-#define	TopStack	((StkElt *)base_temp)
+#define	TopStack	(stack_base + stack_size)
 #define	BaseHeap	((Cell *)top_string)
 
 StkElt	*stack;
 StkElt	*last_update;
-static StkElt	*stack_limit;
+Cell	eval_mark;	/* a mark on the stack, never in the heap */
+static StkElt	*stack_base;	/* lowest element of stack block */
+static long	stack_size;	/* no. of elements in stack block */
 static Cell	*heap, *heap_limit;
 
 #ifdef	STATS
@@ -29,22 +37,54 @@ static long	max_stack;	/* max. size of stack */
 static int	collections;	/* no. of garbage collections */
 static long	gc_time;	/* amount of time spent collecting garbage */
 
-#define	StackOverflow	"stack overflow"
 #define	FixedHeapOverflow	"fixed heap overflow"
 #define	HeapOverflow	"heap overflow"
 #define	NearlyThrashing	"pre-emptive heap overflow"
 
 #else
 
-#define	StackOverflow	"out of memory"
 #define	FixedHeapOverflow	"out of memory"
 #define	HeapOverflow	"out of memory"
 #define	NearlyThrashing	"out of memory"
 #endif
 
+/* The stack is separate, so its overflow is always reported as such. */
+#define	StackOverflow	"stack overflow"
+
 static Cell	*free_list;
 static long	num_free;	/* number of free cells */
 
+/*
+ *	Constant applicative forms (CAFs), i.e. functions of arity zero.
+ *	The value of each is built at most once, on its first reference,
+ *	and shared by all later references (cf caf_value()).
+ *	The heap is reset whenever anything is type checked, so between
+ *	evaluations the values are kept in a separate CAF space, to which
+ *	they are copied at the end of each evaluation (cf keep_cafs()).
+ *	The CAF space is divided in two halves, used alternately, each
+ *	1/CAF_SHARE of the size of the heap when it is first needed.
+ *	A value that does not fit is simply not shared between evaluations.
+ */
+#define	MAX_CAFS	200	/* max. no. of shared CAFs (checked) */
+#define	CAF_SHARE	4	/* heap size / size of each half of CAF space */
+
+/*
+ *	Heap-pressure policy: if a garbage collection recovers less than
+ *	1/CAF_PRESSURE of the heap, the CAFs cease to be roots.
+ */
+#define	CAF_PRESSURE	4
+
+static Func	*caf_list[MAX_CAFS];	/* functions with shared values */
+static int	num_cafs;
+static Cell	*caf_base, *caf_top;	/* the half in use */
+static Cell	*caf_spare;		/* the other half */
+static Cell	**caf_orig;	/* the original of each cell in caf_spare */
+static long	caf_size;	/* no. of cells in each half of CAF space */
+static Bool	cafs_dirty;	/* an evaluation was started and not kept */
+
+static void	drop_cafs(void);
+static void	grow_stack(int required);
+
 /*
  *	Set up the heap and free list, but not garbage collection.
  *	Required before any calls to new_cell().
@@ -71,17 +111,27 @@ start_heap(void)
 void
 start_stack(void)
 {
-	/* Split the available space between the heap and stack. */
-	heap_limit = BaseHeap +
-		((char *)TopStack - (char *)BaseHeap)*HEAP /
-			((HEAP+STACK)*sizeof(Cell));
+	/* CAFs left over from an aborted evaluation may be incomplete. */
+	if (cafs_dirty)
+		reset_cafs();
+	cafs_dirty = TRUE;
+	/* no CAF keeps an array, so all blocks are garbage */
+	free_arrays();
+	clear_memo();
+
+	/* The heap gets all the available space. */
+	heap_limit = BaseHeap + (base_temp - top_string)/sizeof(Cell);
 	/* Check that heap hasn't grown too big already. */
 	if (heap_limit < heap)
 		error(EXECERR, FixedHeapOverflow);
 
+	if (stack_base == nullptr) {
+		stack_size = INIT_STACK;
+		stack_base = (StkElt *)malloc(stack_size*sizeof(StkElt));
+		if (stack_base == nullptr)
+			error(FATALERR, "can't allocate stack");
+	}
 	stack = TopStack;
-	stack_limit = stack -
-		((char *)TopStack - (char *)heap_limit)/sizeof(StkElt);
 	last_update = nullptr;
 }
 
@@ -92,8 +142,49 @@ chk_stack(int required)
 	if ((char *)TopStack - (char *)stack > max_stack)
 		max_stack = (char *)TopStack - (char *)stack;
 #endif
-	if (stack - required < stack_limit)
+	if (stack - required < stack_base)
+		grow_stack(required);
+}
+
+/*
+ *	Move the stack to a larger block, with the same contents at the top.
+ *	The only pointers into the stack are stack, last_update and the
+ *	links between update frames, so these are relocated.
+ */
+static void
+grow_stack(int required)
+{
+	StkElt	*new_base, *frame;
+	long	new_size, used, limit;
+
+	used = TopStack - stack;
+	limit = (long)stack_limit*1024/sizeof(StkElt);
+	if (used + required > limit)
+		error(EXECERR, StackOverflow);
+	new_size = 2*stack_size;
+	if (new_size < used + required)
+		new_size = used + required;
+	if (new_size > limit)
+		new_size = limit;
+	new_base = (StkElt *)malloc(new_size*sizeof(StkElt));
+	if (new_base == nullptr)
 		error(EXECERR, StackOverflow);
+
+#define	Relocate(p)	(new_base + new_size - (TopStack - (p)))
+	(void)memcpy(Relocate(stack), stack, used*sizeof(StkElt));
+	if (last_update != nullptr) {
+		last_update = Relocate(last_update);
+		for (frame = last_update;
+		     frame->stk_update != nullptr;
+		     frame = frame->stk_update)
+			frame->stk_update = Relocate(frame->stk_update);
+	}
+	stack = Relocate(stack);
+#undef	Relocate
+
+	free(stack_base);
+	stack_base = new_base;
+	stack_size = new_size;
 }
 
 Cell *
@@ -124,6 +215,13 @@ new_cell(int c_class)
 
 static void	gc(Cell *current);
 static void	reach(Cell *cell);
+static void	reach_block(Array *block);
+
+/*
+ *	If you don't get this many, give up, to prevent thrashing.
+ *	This number must be at least 1.
+ */
+#define	MIN_RECOVERED	100
 
 /*
  *	Make sure that the free list has the required number of cells.
@@ -138,6 +236,8 @@ static void	reach(Cell *cell);
 void
 chk_heap(Cell *current, int required)	/* required no. of free cells */
 {
+	if (arrays_full())	/* free blocks outside the heap */
+		gc(current);
 	while (num_free < required)
 		/* expand the heap, if possible */
 		if (heap < heap_limit) {
@@ -146,6 +246,14 @@ chk_heap(Cell *current, int required)	/* required no. of free cells */
 			num_free++;
 		} else {	/* try to collect garbage */
 			gc(current);
+			if (num_cafs > 0 &&
+			    num_free < (heap - BaseHeap)/CAF_PRESSURE) {
+				/* free whatever only the CAFs were holding on to */
+				drop_cafs();
+				gc(current);
+			}
+			if (num_free < MIN_RECOVERED)
+				error(EXECERR, NearlyThrashing);
 			if (num_free < required)
 				error(EXECERR, HeapOverflow);
 			return;
@@ -162,12 +270,6 @@ chk_heap(Cell *current, int required)	/* required no. of free cells */
  * Collect garbage, the mark-sweep scheme.
  */
 
-/*
- *	If you don't get this many, give up, to prevent thrashing.
- *	This number must be at least 1.
- */
-#define	MIN_RECOVERED	100
-
 #define	GC_Mark(cell)	((cell)->c_class |= GC_MARK)
 #define	GC_UnMark(cell)	((cell)->c_class &= ~GC_MARK)
 #define	GC_Marked(cell)	((cell)->c_class & GC_MARK)
@@ -184,11 +286,17 @@ gc(Cell *current)
 #ifdef STATS
 	times(&before);
 #endif
-	/* mark each cell in the heap */
+	/*
+	 * mark each cell in the heap, and in CAF space, which may have
+	 * been updated to point into the heap
+	 */
 	for (cp = BaseHeap; cp != heap; cp++)
 		GC_Mark(cp);
+	for (cp = caf_base; cp != caf_top; cp++)
+		GC_Mark(cp);
 	/* unmark reachable cells */
 	reach(expr_type);
+	reach(memo_table);
 	reach(current);
 	save_stack = stack;
 	save_last_update = last_update;
@@ -196,6 +304,11 @@ gc(Cell *current)
 		reach(IsUpdate() ? PopUpdate() : Pop());
 	stack = save_stack;
 	last_update = save_last_update;
+	for (int i = 0; i < num_cafs; i++)
+		reach(caf_list[i]->f_value);
+	for (cp = caf_base; cp != caf_top; cp++)
+		GC_UnMark(cp);
+	sweep_arrays();
 	/* add unreachable cells to the free list */
 	num_free = 0;
 	free_list = NOCELL;
@@ -216,8 +329,6 @@ gc(Cell *current)
 	collections++;
 	gc_time += after.tms_utime - before.tms_utime;
 #endif
-	if (num_free < MIN_RECOVERED)
-		error(EXECERR, NearlyThrashing);
 }
 
 static void
@@ -227,6 +338,10 @@ reach(Cell *cell)
 		GC_UnMark(cell);
 		switch (CellArity(cell->c_class)) {
 		case 0:
+			if (cell->c_class == C_ARRAY)
+				reach_block(cell->c_block);
+			else if (cell->c_class == C_VECTOR)
+				cell->c_block->a_marked = TRUE;
 			return;
         case 1:
 			cell = cell->c_sub;
@@ -242,6 +357,215 @@ reach(Cell *cell)
 	}
 }
 
+/* the elements of all slices of an array are kept */
+static void
+reach_block(Array *block)
+{
+	if (! block->a_marked) {
+		block->a_marked = TRUE;
+		for (int i = 0; i < block->a_size; i++)
+			reach(block->a_elt[i]);
+	}
+}
+
+/*
+ *	The shared value of a CAF, to be entered with an update frame.
+ */
+Cell *
+caf_value(Func *fn)
+{
+	if (fn->f_value == NOCELL) {
+		if (num_cafs == MAX_CAFS)	/* don't share it */
+			return new_ucase(fn->f_code, NOCELL);
+		fn->f_value = new_ucase(fn->f_code, NOCELL);
+		caf_list[num_cafs++] = fn;
+	}
+	return fn->f_value;
+}
+
+/*
+ *	The CAFs cease to be roots: their values will be rebuilt if needed.
+ *	Any cells in CAF space stay put until the end of the evaluation.
+ */
+static void
+drop_cafs(void)
+{
+	while (num_cafs > 0)
+		caf_list[--num_cafs]->f_value = NOCELL;
+}
+
+/*
+ *	Forget the values of all CAFs, e.g. because a definition they
+ *	might depend on has changed.
+ */
+void
+reset_cafs(void)
+{
+	drop_cafs();
+	caf_top = caf_base;
+}
+
+static Cell	*caf_next;	/* next free cell in the spare half */
+
+static Cell	*forward(Cell *cell);
+static Bool	copy_cells(Cell *scan);
+static void	undo_copies(Cell *mark);
+static Cell	*original(Cell *cell);
+
+/*
+ * Copy a cell into the spare half of CAF space, leaving a forwarding
+ * pointer in the original, which is marked.
+ * Returns NOCELL if there is no room.
+ */
+static Cell *
+forward(Cell *cell)
+{
+	Cell	*copy;
+
+	if (GC_Marked(cell))
+		return cell->c_sub;
+	if (caf_next == caf_spare + caf_size)
+		return NOCELL;
+	copy = caf_next++;
+	*copy = *cell;
+	caf_orig[copy - caf_spare] = cell;
+	GC_Mark(cell);
+	cell->c_sub = copy;
+	return copy;
+}
+
+/*
+ *	At the end of an evaluation, copy the values of the CAFs into CAF
+ *	space, so that they survive the resetting of the heap.
+ *	This is a Cheney-style copying collection, from both the heap and
+ *	the old half of CAF space, neither of which are used again.
+ *	The CAFs are copied one at a time.  A value still under evaluation
+ *	(holes) or holding on to open files or arrays is not kept, nor is
+ *	one for which there is no room: its copy is undone, and the CAFs
+ *	already copied are kept.
+ */
+void
+keep_cafs(void)
+{
+	Cell	*scan;
+	int	kept;
+
+	cafs_dirty = FALSE;
+	if (num_cafs == 0) {
+		caf_top = caf_base;
+		return;
+	}
+	if (caf_base == NOCELL) {
+		caf_size = (heap_limit - BaseHeap)/CAF_SHARE;
+		caf_base = caf_top = (Cell *)malloc(caf_size*sizeof(Cell));
+		caf_spare = (Cell *)malloc(caf_size*sizeof(Cell));
+		caf_orig = (Cell **)malloc(caf_size*sizeof(Cell *));
+		if (caf_base == NOCELL || caf_spare == NOCELL ||
+		    caf_orig == nullptr) {
+			free(caf_base);
+			free(caf_spare);
+			free(caf_orig);
+			caf_base = caf_top = caf_spare = NOCELL;
+			caf_orig = nullptr;
+			drop_cafs();
+			return;
+		}
+	}
+	caf_next = caf_spare;
+	kept = 0;
+	for (int i = 0; i < num_cafs; i++) {
+		auto fn = caf_list[i];
+		auto mark = caf_next;
+		auto value = forward(fn->f_value);
+		if (value != NOCELL && copy_cells(mark)) {
+			fn->f_value = value;
+			caf_list[kept++] = fn;
+		} else {
+			undo_copies(mark);
+			fn->f_value = NOCELL;
+		}
+	}
+	num_cafs = kept;
+	scan = caf_base;
+	caf_base = caf_spare;
+	caf_spare = scan;
+	caf_top = caf_next;
+}
+
+/*
+ *	Copy the cells reachable from those from scan on in the spare half,
+ *	returning FALSE if one of them can't be kept, or there is no room.
+ */
+static Bool
+copy_cells(Cell *scan)
+{
+	Cell	*copy;
+
+	for ( ; scan != caf_next; scan++)
+		switch (CellArity(scan->c_class)) {
+		case 0:
+			if (scan->c_class == C_HOLE ||
+			    scan->c_class == C_STREAM ||
+			    scan->c_class == C_ARRAY ||
+			    scan->c_class == C_VECTOR)
+				return FALSE;
+			break;
+		case 1:
+			if (scan->c_sub != NOCELL) {
+				if ((copy = forward(scan->c_sub)) == NOCELL)
+					return FALSE;
+				scan->c_sub = copy;
+			}
+			break;
+		case 2:
+			if (scan->c_sub1 != NOCELL) {
+				if ((copy = forward(scan->c_sub1)) == NOCELL)
+					return FALSE;
+				scan->c_sub1 = copy;
+			}
+			if (scan->c_sub2 != NOCELL) {
+				if ((copy = forward(scan->c_sub2)) == NOCELL)
+					return FALSE;
+				scan->c_sub2 = copy;
+			}
+			break;
+		default:
+			NOT_REACHED;
+		}
+	return TRUE;
+}
+
+/*
+ *	Put back the originals of the cells copied from mark on, so that
+ *	the CAFs copied later that share them copy them afresh.
+ */
+static void
+undo_copies(Cell *mark)
+{
+	for (auto cp = mark; cp != caf_next; cp++) {
+		switch (CellArity(cp->c_class)) {
+		case 1:
+			cp->c_sub = original(cp->c_sub);
+			break;
+		case 2:
+			cp->c_sub1 = original(cp->c_sub1);
+			cp->c_sub2 = original(cp->c_sub2);
+			break;
+		}
+		*caf_orig[cp - caf_spare] = *cp;
+	}
+	caf_next = mark;
+}
+
+/* the original of a pointer that may have been forwarded */
+static Cell *
+original(Cell *cell)
+{
+	if (cell >= caf_spare && cell < caf_spare + caf_size)
+		return caf_orig[cell - caf_spare];
+	return cell;
+}
+
 void
 heap_stats(void)
 {
@@ -255,6 +579,12 @@ heap_stats(void)
 	(void)fprintf(stdout,
 		"dynamic: %ld (heap) + %ld (stack) = %ld bytes\n",
 		max_heap, max_stack, max_heap + max_stack);
+	(void)fprintf(stdout,
+		"stack: %ld bytes allocated, limit %d Kbytes\n",
+		(long)(stack_size*sizeof(StkElt)), stack_limit);
+	(void)fprintf(stdout,
+		"CAFs: %d kept in %ld bytes\n",
+		num_cafs, (long)((caf_top - caf_base)*sizeof(Cell)));
 	if (collections != 0)
 		(void)fprintf(stdout,
 			"%d garbage collections, average %ldms\n",
@@ -0,0 +1,1601 @@
+#include "defs.h"
+#include "simplify.h"
+#include "expr.h"
+#include "cons.h"
+#include "cases.h"
+#include "char_array.h"
+#include "deftype.h"
+#include "compile.h"
+#include "memory.h"
+#include "path.h"
+
+/*
+ *	Simplification of expressions before they are compiled.
+ *
+ *	Working on a copy of the expression, this
+ *	- inlines full applications of small non-recursive functions
+ *	  from modules that have been completely read (so that no more
+ *	  equations can be added to them), if their arguments can be
+ *	  matched against the patterns at compile time,
+ *	- beta-reduces applications of lambdas, lets and wheres, likewise,
+ *	  so that case analysis of a known constructor, number or
+ *	  character selects its branch, and
+ *	- evaluates arithmetic builtins and compare on constant arguments,
+ *	- specialises small recursive functions from other modules, such
+ *	  as map, filter and the folds, at calls where an argument that is
+ *	  passed on unchanged to each recursive call is a known function,
+ *	  making a local recursive copy with that function inlined,
+ *	- fuses producers and consumers of lists from the library modules,
+ *	  so that no intermediate list is built, e.g.
+ *		foldr(c, op) (map f xs)	=> foldr(c, foldr_map(f, op)) xs
+ *		foldl(c, op) (m..n)	=> foldl_range(c, op)(m, n)
+ *		fold F f (unfold F g x)	=> hylo F f g x
+ *	  using auxiliary functions defined in those modules,
+ *	- floats subexpressions that do not depend on the variables of a
+ *	  lambda out of it (full laziness), and shares repeated
+ *	  subexpressions of a body (common subexpressions), binding each
+ *	  with a let so that it is evaluated at most once in that scope.
+ *	  To avoid holding on to large structures, only applications
+ *	  yielding numbers, characters or enumerations are bound, a few
+ *	  per scope, and never outside the enclosing definition.
+ *	Matching at compile time follows the matching trees built by
+ *	compile.c, so it makes the same choices as the interpreter.
+ *	An argument is substituted for a variable only if it is cheap, or
+ *	is used once and not inside a lambda, so that no work is repeated.
+ */
+
+#define	INLINE_SIZE	16	/* max. size of an inlined function body */
+#define	INLINE_DEPTH	8	/* max. nesting of inlining */
+#define	MAX_ARGS	8	/* max. args of an inlined function */
+#define	MAX_USES	16	/* max. substituted argument expressions */
+#define	SPEC_SIZE	48	/* max. size of a specialised function */
+#define	SPEC_BUDGET	256	/* max. size of specialised copies in a body */
+#define	STATIC_DEPTH	3	/* max. depth of a known function in an arg */
+#define	MAX_FLOAT	4	/* max. expressions floated out of a lambda */
+#define	MAX_SHARE	4	/* max. common subexpressions bound in a body */
+#define	FLOAT_BUDGET	4096	/* max. size of copies made by abstract() */
+
+static	int	spec_budget;	/* what remains of SPEC_BUDGET */
+static	int	float_budget;	/* what remains of FLOAT_BUDGET */
+
+static Expr	*simp(Expr *expr, int depth, int fuel);
+static void	simp_branches(Branch *branch, int depth, int fuel);
+static Expr	*reduce(Expr *expr, int depth, int fuel);
+static Expr	*fold(Func *fn, Expr *arg);
+static Expr	*fuse(Expr *expr);
+static Func	*call(Expr *expr, int nargs, Expr **args);
+static Expr	*apply_fn(Func *fn, Expr *arg);
+static Expr	*match(UCase *code, Expr **args, int nargs);
+static Expr	*resolve(Expr *expr, Path path);
+static Cons	*known_cons(Expr *expr);
+
+static Expr	*specialise(Func *fn, Expr **args, int nargs);
+static Bool	find_static(Expr *arg, Path path, int depth);
+static Bool	invariant(Expr *expr, int local);
+static Bool	inv_branches(Branch *branch, int local);
+static Expr	*spec_copy(Expr *expr, int local);
+static Branch	*spec_branches(Branch *branch, int local);
+
+static Expr	*hoist(Expr *expr);
+static void	hoist_branches(Branch *branch);
+static Expr	*float_out(Expr *lambda, int n);
+static Expr	*share(Expr *body, int n);
+static Bool	affordable(Expr *expr);
+static Expr	*movable(Expr *expr, int local, Expr *body);
+static Expr	*mov_branches(Branch *branch, int local, Expr *body);
+static int	occurrences(Expr *expr, int local, Expr *sub);
+static Expr	*abstract(Expr *expr, int local, Expr *sub);
+static Branch	*abs_branches(Branch *branch, int local, Expr *sub);
+static Expr	*new_var(void);
+
+static Expr	*substitute(Expr *body, int outer, int nargs, Expr **args);
+static Expr	*subst(Expr *expr, int local, Bool under_lambda);
+static Branch	*subst_branches(Branch *branch, int local, int arity,
+			Bool under_lambda);
+static Expr	*lift(Expr *expr, int local, int shift);
+static Branch	*lift_branches(Branch *branch, int local, int shift);
+static Expr	*copy_node(Expr *expr);
+
+static Bool	cheap(Expr *expr);
+static Bool	known(Expr *expr);
+static Bool	contains(Expr *expr, Expr *sub);
+static int	size(Expr *expr, int limit);
+static Bool	calls(Expr *expr, Func *fn);
+static Bool	same(Expr *e1, Expr *e2, int shift);
+static Bool	closed(Expr *expr, int local);
+static Bool	flat(Expr *expr);
+static Bool	IsApply(Expr *expr);
+
+Expr *
+simplify(Expr *expr, int depth)
+{
+	if (! simplifying)
+		return expr;
+	spec_budget = SPEC_BUDGET;
+	float_budget = FLOAT_BUDGET;
+	expr = simp(lift(expr, 0, 0), depth, INLINE_DEPTH);
+	return share(hoist(expr), 0);
+}
+
+/*
+ *	Simplify expr (a copy, updated in place) nested within depth scopes,
+ *	inlining to a further depth of fuel.
+ */
+static Expr *
+simp(Expr *expr, int depth, int fuel)
+{
+	Expr	*node;
+
+	switch (expr->e_class) {
+	case expr_type::E_PAIR:
+		expr->e_left = simp(expr->e_left, depth, fuel);
+		expr->e_right = simp(expr->e_right, depth, fuel);
+		return expr;
+	case expr_type::E_APPLY:
+	case expr_type::E_IF:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+		for (node = expr; ; node = node->e_func) {
+			node->e_arg = simp(node->e_arg, depth, fuel);
+			if (! IsApply(node->e_func))
+				break;
+		}
+		node->e_func = simp(node->e_func, depth, fuel);
+		return reduce(expr, depth, fuel);
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+		simp_branches(expr->e_func->e_branch, depth+1, fuel);
+		expr->e_arg = simp(expr->e_arg, depth+1, fuel);
+		return expr;
+	case expr_type::E_MU:
+		expr->e_body = simp(expr->e_body, depth+1, fuel);
+		return expr;
+	case expr_type::E_LAMBDA:
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		simp_branches(expr->e_branch, depth + expr->e_arity, fuel);
+		return expr;
+	case expr_type::E_NUM:
+	case expr_type::E_CHAR:
+	case expr_type::E_CONS:
+	case expr_type::E_DEFUN:
+	case expr_type::E_PARAM:
+		return expr;
+	case expr_type::E_VAR:
+	case expr_type::E_PLUS:
+	case expr_type::E_BANG:
+	case expr_type::E_BUILTIN:
+	case expr_type::E_BU_1MATH:
+	case expr_type::E_BU_2MATH:
+	case expr_type::E_RETURN:
+	case expr_type::E_NCLASSES:
+		NOT_REACHED;
+	}
+}
+
+/*
+ *	The bodies of lambdas are simplified apart from the originals,
+ *	which are kept for printing function values.
+ */
+static void
+simp_branches(Branch *branch, int depth, int fuel)
+{
+	for ( ; branch != nullptr; branch = branch->br_next) {
+		if (branch->br_body == branch->br_expr)
+			branch->br_body = lift(branch->br_body, 0, 0);
+		branch->br_body = simp(branch->br_body, depth, fuel);
+	}
+}
+
+/*
+ *	Reduce the application expr, whose parts are already simplified,
+ *	if possible.
+ */
+static Expr *
+reduce(Expr *expr, int depth, int fuel)
+{
+	Expr	*head;
+	Expr	*args[MAX_ARGS];
+	Expr	*body;
+	Expr	*result;
+	Expr	*node;
+	int	n, arity, i;
+
+	if ((result = fuse(expr)) != nullptr)
+		return simp(result, depth, fuel);
+
+	n = 0;
+	for (head = expr; IsApply(head); head = head->e_func)
+		n++;
+	switch (head->e_class) {
+	case expr_type::E_DEFUN:
+		if (head->e_defun->f_branch == nullptr)	/* built-in */
+			return n == 1 && (result = fold(head->e_defun,
+						expr->e_arg)) != nullptr ?
+				result : expr;
+		arity = head->e_defun->f_arity;
+		if (fuel == 0 || arity == 0 || arity > n || arity > MAX_ARGS ||
+		    fn_local(head->e_defun->f_name) == head->e_defun)
+			return expr;
+		break;
+	case expr_type::E_LAMBDA:
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		arity = head->e_arity;
+		if (fuel == 0 || arity > n || arity > MAX_ARGS)
+			return expr;
+		break;
+	default:
+		return expr;
+	}
+
+	/* the first arity arguments, and the node applied to the rest */
+	node = nullptr;
+	for (i = n-1, head = expr; i >= arity; i--, head = head->e_func)
+		node = head;
+	for ( ; i >= 0; i--, head = head->e_func)
+		args[i] = head->e_arg;
+
+	if (head->e_class == expr_type::E_DEFUN) {
+		body = match(head->e_defun->f_code, args, arity);
+		if (body != nullptr && size(body, INLINE_SIZE) <= INLINE_SIZE &&
+		    ! calls(body, head->e_defun))
+			result = substitute(body, 0, arity, args);
+		else
+			result = specialise(head->e_defun, args, arity);
+	} else {
+		comp_expr(head);	/* for its matching tree */
+		body = match(head->e_code, args, arity);
+		if (body == nullptr)
+			return expr;
+		result = substitute(body, depth, arity, args);
+	}
+	if (result == nullptr)
+		return expr;
+	if (node == nullptr)
+		expr = result;
+	else
+		node->e_func = result;
+	return simp(expr, depth, fuel-1);
+}
+
+/*
+ *	Evaluate a built-in function on a constant argument, if possible.
+ */
+static Expr *
+fold(Func *fn, Expr *arg)
+{
+static	String	compare_name;
+	Expr	*left, *right;
+	int	rel;
+
+	if (fn->f_code == nullptr)
+		return nullptr;
+	if (fn->f_code->uc_class == uc_type::UC_STRICT) {
+		auto real = fn->f_code->uc_real;
+		if (real->e_class == expr_type::E_BU_1MATH &&
+		    arg->e_class == expr_type::E_NUM)
+			return num_expr((*(real->e_1math))(arg->e_num));
+		if (real->e_class == expr_type::E_BU_2MATH &&
+		    arg->e_class == expr_type::E_PAIR &&
+		    arg->e_left->e_class == expr_type::E_NUM &&
+		    arg->e_right->e_class == expr_type::E_NUM &&
+		    arg->e_right->e_num != Zero)	/* no errors here */
+			return num_expr((*(real->e_2math))
+					(arg->e_left->e_num,
+					 arg->e_right->e_num));
+		return nullptr;
+	}
+	if (compare_name == nullptr)
+		compare_name = newstring("compare");
+	if (fn->f_name != compare_name || arg->e_class != expr_type::E_PAIR)
+		return nullptr;
+	left = arg->e_left;
+	right = arg->e_right;
+	if (left->e_class != right->e_class)
+		return nullptr;
+	switch (left->e_class) {
+	case expr_type::E_NUM:
+		rel = left->e_num == right->e_num ? EQUAL :
+			left->e_num < right->e_num ? LESS : GREATER;
+		break;
+	case expr_type::E_CHAR:
+		rel = left->e_char == right->e_char ? EQUAL :
+			left->e_char < right->e_char ? LESS : GREATER;
+		break;
+	case expr_type::E_CONS:
+		if (left->e_const->c_nargs != 0 ||
+		    right->e_const->c_nargs != 0)
+			return nullptr;
+		rel = left->e_const == right->e_const ? EQUAL :
+			left->e_const->c_index < right->e_const->c_index ?
+				LESS : GREATER;
+		break;
+	default:
+		return nullptr;
+	}
+	return cons_expr(cons_lookup(newstring(rel == LESS ? "LESS" :
+					rel == EQUAL ? "EQUAL" : "GREATER")));
+}
+
+/*
+ *	Fusion of list pipelines.
+ *	Each rewrite removes a call of a producer, so they terminate.
+ */
+
+static	Func	*fu_o, *fu_map, *fu_filter, *fu_foldr, *fu_foldl;
+static	Func	*fu_foldr_map, *fu_foldr_filter, *fu_foldl_map, *fu_foldl_filter;
+static	Func	*fu_filter_filter;
+static	Func	*fu_range, *fu_foldr_range, *fu_foldl_range;
+static	Func	*fu_fold, *fu_unfold, *fu_hylo;
+
+static const struct {
+	const	char	*fu_module;
+	const	char	*fu_name;
+	Func	**fu_func;
+} fusable[] = {
+	{ "Standard",	"o",		&fu_o },
+	{ "list",	"map",		&fu_map },
+	{ "list",	"filter",	&fu_filter },
+	{ "list",	"foldr",	&fu_foldr },
+	{ "list",	"foldl",	&fu_foldl },
+	{ "list",	"foldr_map",	&fu_foldr_map },
+	{ "list",	"foldr_filter",	&fu_foldr_filter },
+	{ "list",	"foldl_map",	&fu_foldl_map },
+	{ "list",	"foldl_filter",	&fu_foldl_filter },
+	{ "list",	"filter_filter", &fu_filter_filter },
+	{ "range",	"..",		&fu_range },
+	{ "range",	"foldr_range",	&fu_foldr_range },
+	{ "range",	"foldl_range",	&fu_foldl_range },
+	{ "fold",	"fold",		&fu_fold },
+	{ "fold",	"unfold",	&fu_unfold },
+	{ "fold",	"hylo",		&fu_hylo },
+};
+
+void
+fuse_module(String name)
+{
+	for (const auto &fu : fusable)
+		if (strcmp(fu.fu_module, name) == 0)
+			*fu.fu_func = fn_local(newstring(fu.fu_name));
+}
+
+/*
+ *	The result of fusing the application expr with its argument,
+ *	or nullptr if no rule applies.
+ */
+static Expr *
+fuse(Expr *expr)
+{
+	Expr	*outer[3], *inner[3];
+	Func	*fn;
+	Func	*producer;
+	Func	*aux;
+
+	if ((fn = call(expr, 2, outer)) != nullptr &&
+	    (producer = call(outer[1], 2, inner)) != nullptr) {
+		/* map f (map g xs) => map (f o g) xs */
+		if (fn == fu_map && producer == fu_map && fu_o != nullptr)
+			return apply_expr(apply_fn(fu_map,
+					apply_fn(fu_o,
+						pair_expr(outer[0], inner[0]))),
+				inner[1]);
+		/* filter p (filter q xs) => filter (filter_filter(q, p)) xs */
+		if (fn == fu_filter && producer == fu_filter &&
+		    fu_filter_filter != nullptr)
+			return apply_expr(apply_fn(fu_filter,
+					apply_fn(fu_filter_filter,
+						pair_expr(inner[0], outer[0]))),
+				inner[1]);
+		/* foldr(c, op) (map f xs) => foldr(c, foldr_map(f, op)) xs */
+		aux = fn == fu_foldr ?
+				producer == fu_map ? fu_foldr_map :
+				producer == fu_filter ? fu_foldr_filter :
+				nullptr :
+			fn == fu_foldl ?
+				producer == fu_map ? fu_foldl_map :
+				producer == fu_filter ? fu_foldl_filter :
+				nullptr :
+			nullptr;
+		if (aux != nullptr && outer[0]->e_class == expr_type::E_PAIR)
+			return apply_expr(apply_fn(fn,
+					pair_expr(outer[0]->e_left,
+						apply_fn(aux,
+							pair_expr(inner[0],
+							    outer[0]->e_right)))),
+				inner[1]);
+	}
+	/* foldr(c, op) (m..n) => foldr_range(c, op)(m, n) */
+	if (fn != nullptr && call(outer[1], 1, inner) == fu_range) {
+		aux = fn == fu_foldr ? fu_foldr_range :
+			fn == fu_foldl ? fu_foldl_range : nullptr;
+		if (aux != nullptr)
+			return apply_expr(apply_fn(aux, outer[0]), inner[0]);
+	}
+	/* fold F f (unfold F g x) => hylo F f g x */
+	if (call(expr, 3, outer) == fu_fold && fu_fold != nullptr &&
+	    call(outer[2], 3, inner) == fu_unfold &&
+	    fu_hylo != nullptr && same(outer[0], inner[0], 0))
+		return apply_expr(apply_expr(apply_expr(apply_fn(fu_hylo,
+								outer[0]),
+						outer[1]),
+					inner[1]),
+				inner[2]);
+	return nullptr;
+}
+
+/*
+ *	If expr is an application of a defined function to nargs arguments,
+ *	that function, with the arguments in args.
+ */
+static Func *
+call(Expr *expr, int nargs, Expr **args)
+{
+	while (nargs > 0 && expr->e_class == expr_type::E_APPLY) {
+		args[--nargs] = expr->e_arg;
+		expr = expr->e_func;
+	}
+	return nargs == 0 && expr->e_class == expr_type::E_DEFUN ?
+		expr->e_defun : nullptr;
+}
+
+static Expr *
+apply_fn(Func *fn, Expr *arg)
+{
+	auto head = NEW(Expr);
+	head->e_class = expr_type::E_DEFUN;
+	head->e_used = ENV_ALL;
+	head->e_defun = fn;
+	return apply_expr(head, arg);
+}
+
+/*
+ *	Follow the matching tree code for the given arguments,
+ *	returning the body selected, or nullptr if that can't be known
+ *	until run time.
+ */
+static Expr *
+match(UCase *code, Expr **args, int nargs)
+{
+	Expr	*arg;
+	Cons	*cp;
+	LCase	*lcase;
+
+	for (;;)
+		switch (code->uc_class) {
+		case uc_type::UC_SUCCESS:
+			return code->uc_body;
+		case uc_type::UC_CASE:
+			/* level 0 is the last argument */
+			arg = resolve(args[nargs-1 - code->uc_level],
+					code->uc_path);
+			if (arg == nullptr)
+				return nullptr;
+			lcase = code->uc_cases;
+			switch (lcase->lc_class) {
+			case lc_type::LC_ALGEBRAIC:
+				if ((cp = known_cons(arg)) == nullptr)
+					return nullptr;
+				code = lcase->lc_limbs[cp->c_index];
+				break;
+			case lc_type::LC_NUMERIC:
+				if (arg->e_class != expr_type::E_NUM)
+					return nullptr;
+				code = lcase->lc_limbs[arg->e_num < Zero ? LESS :
+							arg->e_num == Zero ?
+								EQUAL : GREATER];
+				break;
+			case lc_type::LC_CHARACTER:
+				if (arg->e_class != expr_type::E_CHAR)
+					return nullptr;
+				code = ca_index(lcase->lc_c_limbs, arg->e_char);
+				break;
+			case lc_type::LC_EVAL:	/* head normal form? */
+				if (arg->e_class != expr_type::E_NUM &&
+				    arg->e_class != expr_type::E_CHAR &&
+				    arg->e_class != expr_type::E_PAIR &&
+				    known_cons(arg) == nullptr && ! known(arg))
+					return nullptr;
+				code = lcase->lc_limbs[0];
+				break;
+			}
+			break;
+		case uc_type::UC_F_NOMATCH:
+		case uc_type::UC_L_NOMATCH:
+		case uc_type::UC_STRICT:
+			return nullptr;
+		}
+}
+
+/*
+ *	The part of expr selected by path (cf p_reverse()), or nullptr if
+ *	that can't be known until run time.  A variable is extended with
+ *	the rest of the path.
+ */
+static Expr *
+resolve(Expr *expr, Path path)
+{
+	for ( ; ! p_empty(path); path = p_pop(path)) {
+		if (expr->e_class == expr_type::E_PARAM) {
+			auto where = NEWARRAY(char,
+					strlen(expr->e_where) + strlen(path) + 1);
+			(void)strcpy(where, expr->e_where);
+			(void)strcat(where, path);
+			auto var = copy_node(expr);
+			var->e_where = where;
+			return var;
+		}
+		switch (p_top(path)) {
+		case P_UNROLL:
+			break;
+		case P_LEFT:
+		case P_RIGHT:
+			if (expr->e_class != expr_type::E_PAIR)
+				return nullptr;
+			expr = p_top(path) == P_LEFT ?
+				expr->e_left : expr->e_right;
+			break;
+		case P_STRIP:
+			if (expr->e_class != expr_type::E_APPLY ||
+			    expr->e_func->e_class != expr_type::E_CONS ||
+			    expr->e_func->e_const->c_nargs != 1)
+				return nullptr;
+			expr = expr->e_arg;
+			break;
+		case P_PRED:
+			if (expr->e_class != expr_type::E_NUM)
+				return nullptr;
+			expr = num_expr(expr->e_num - 1);
+			break;
+		default:
+			NOT_REACHED;
+		}
+	}
+	return expr;
+}
+
+/* the constructor at the head of expr, if known */
+static Cons *
+known_cons(Expr *expr)
+{
+	if (expr->e_class == expr_type::E_CONS)
+		return expr->e_const;
+	if (expr->e_class == expr_type::E_APPLY &&
+	    expr->e_func->e_class == expr_type::E_CONS &&
+	    expr->e_func->e_const->c_nargs == 1)
+		return expr->e_func->e_const;
+	return nullptr;
+}
+
+/*
+ *	Specialisation of a recursive function fn of nargs arguments,
+ *	called with args, at least one part of which is a known function
+ *	that every recursive call passes on unchanged.  The call becomes
+ *
+ *		let rec fn' == lambda formals => body' in fn' args
+ *
+ *	where the bodies of fn become body' by replacing references to
+ *	that part with the known function itself, and calls of fn with
+ *	calls of fn'.  The original arguments are still passed, so other
+ *	references to the part remain valid.
+ */
+static	Func	*spec_fn;
+static	int	spec_nargs;
+static	int	spec_arg;	/* the argument containing the part */
+static	Path	spec_path;	/* the part within it */
+static	Expr	*spec_known;	/* its value */
+static	Expr	*spec_var;	/* pattern for fn' */
+
+static Expr *
+specialise(Func *fn, Expr **args, int nargs)
+{
+	int	total;
+	Branch	*br;
+
+	total = 0;
+	for (br = fn->f_branch; br != nullptr; br = br->br_next)
+		total += size(br->br_body, SPEC_SIZE);
+	if (total > SPEC_SIZE || total > spec_budget)
+		return nullptr;
+	spec_fn = fn;
+	spec_nargs = nargs;
+	for (spec_arg = 0; spec_arg < nargs; spec_arg++)
+		if (find_static(args[spec_arg], p_new(), 0))
+			break;
+	if (spec_arg == nargs)
+		return nullptr;
+	spec_budget -= total + size(spec_known, SPEC_SIZE);
+
+	spec_var = id_expr(fn->f_name);
+	spec_var->e_dirs = p_stash(p_new());
+	auto lambda = func_expr(spec_branches(fn->f_branch, 0));
+	lambda->e_arity = nargs;
+	auto loop = NEW(Expr);
+	loop->e_used = ENV_ALL;
+	loop->e_class = expr_type::E_PARAM;
+	loop->e_level = 0;
+	loop->e_once = FALSE;
+	loop->e_patt = spec_var;
+	loop->e_where = spec_var->e_dirs;
+	auto body = loop;
+	for (int i = 0; i < nargs; i++)
+		body = apply_expr(body, lift(args[i], 0, 1));
+	return let_expr(spec_var, lambda, body, TRUE);
+}
+
+/*
+ *	Look for a known function in arg, at path (in reverse, cf p_push())
+ *	within the argument spec_arg and depth pairs down, that fn passes
+ *	on unchanged.
+ */
+static Bool
+find_static(Expr *arg, Path path, int depth)
+{
+	if (known(arg)) {
+		spec_path = p_stash(p_reverse(path));
+		spec_known = arg;
+		for (auto br = spec_fn->f_branch; br != nullptr; br = br->br_next)
+			if (! invariant(br->br_body, 0))
+				return FALSE;
+		return TRUE;
+	}
+	if (arg->e_class == expr_type::E_PAIR && depth < STATIC_DEPTH)
+		return find_static(arg->e_left, p_push(P_LEFT, path), depth+1) ||
+			find_static(arg->e_right, p_push(P_RIGHT, path),
+					depth+1);
+	return FALSE;
+}
+
+/*
+ *	In expr, nested within local scopes of a body of spec_fn,
+ *	every occurrence of spec_fn is called with at least spec_nargs
+ *	arguments, passing on the part of argument spec_arg at spec_path.
+ */
+static Bool
+invariant(Expr *expr, int local)
+{
+	Expr	*args[MAX_ARGS];
+	Expr	*part;
+
+	switch (expr->e_class) {
+	case expr_type::E_APPLY:
+	case expr_type::E_IF:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+		if (call(expr, spec_nargs, args) != spec_fn)
+			return invariant(expr->e_func, local) &&
+				invariant(expr->e_arg, local);
+		part = resolve(args[spec_arg], spec_path);
+		if (part == nullptr ||
+		    part->e_class != expr_type::E_PARAM ||
+		    part->e_level != spec_nargs-1 - spec_arg + local ||
+		    ! p_equal(part->e_where, spec_path))
+			return FALSE;
+		for (int i = 0; i < spec_nargs; i++)
+			if (! invariant(args[i], local))
+				return FALSE;
+		return TRUE;
+	case expr_type::E_PAIR:
+		return invariant(expr->e_left, local) &&
+			invariant(expr->e_right, local);
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+		return inv_branches(expr->e_func->e_branch, local+1) &&
+			invariant(expr->e_arg, local+1);
+	case expr_type::E_MU:
+		return invariant(expr->e_body, local+1);
+	case expr_type::E_LAMBDA:
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		return inv_branches(expr->e_branch, local + expr->e_arity);
+	case expr_type::E_DEFUN:
+		return expr->e_defun != spec_fn;	/* not called */
+	case expr_type::E_NUM:
+	case expr_type::E_CHAR:
+	case expr_type::E_CONS:
+	case expr_type::E_PARAM:
+		return TRUE;
+	case expr_type::E_VAR:
+	case expr_type::E_PLUS:
+	case expr_type::E_BANG:
+	case expr_type::E_BUILTIN:
+	case expr_type::E_BU_1MATH:
+	case expr_type::E_BU_2MATH:
+	case expr_type::E_RETURN:
+	case expr_type::E_NCLASSES:
+		NOT_REACHED;
+	}
+}
+
+static Bool
+inv_branches(Branch *branch, int local)
+{
+	for ( ; branch != nullptr; branch = branch->br_next)
+		if (! invariant(branch->br_body, local))
+			return FALSE;
+	return TRUE;
+}
+
+/*
+ *	A copy of expr, nested within local scopes of a body of spec_fn,
+ *	for the body of the specialised version, which is within the
+ *	scope of fn' and has the same arguments.
+ */
+static Expr *
+spec_copy(Expr *expr, int local)
+{
+	Expr	*copy;
+
+	switch (expr->e_class) {
+	case expr_type::E_PARAM:
+		if (expr->e_level == spec_nargs-1 - spec_arg + local &&
+		    p_equal(expr->e_where, spec_path))
+			return lift(spec_known, 0, 1 + spec_nargs + local);
+		return expr;
+	case expr_type::E_DEFUN:
+		if (expr->e_defun != spec_fn)
+			return expr;
+		copy = NEW(Expr);
+		copy->e_used = ENV_ALL;
+		copy->e_class = expr_type::E_PARAM;
+		copy->e_level = spec_nargs + local;
+		copy->e_once = FALSE;
+		copy->e_patt = spec_var;
+		copy->e_where = spec_var->e_dirs;
+		return copy;
+	case expr_type::E_PAIR:
+		return pair_expr(spec_copy(expr->e_left, local),
+				spec_copy(expr->e_right, local));
+	case expr_type::E_APPLY:
+	case expr_type::E_IF:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+		copy = copy_node(expr);
+		copy->e_func = spec_copy(expr->e_func, local);
+		copy->e_arg = spec_copy(expr->e_arg, local);
+		return copy;
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+		copy = copy_node(expr);
+		copy->e_func = copy_node(expr->e_func);
+		copy->e_func->e_branch = spec_branches(expr->e_func->e_branch,
+						local+1);
+		copy->e_arg = spec_copy(expr->e_arg, local+1);
+		return copy;
+	case expr_type::E_MU:
+		copy = copy_node(expr);
+		copy->e_body = spec_copy(expr->e_body, local+1);
+		return copy;
+	case expr_type::E_LAMBDA:
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		copy = copy_node(expr);
+		copy->e_branch = spec_branches(expr->e_branch,
+					local + expr->e_arity);
+		return copy;
+	case expr_type::E_NUM:
+	case expr_type::E_CHAR:
+	case expr_type::E_CONS:
+		return expr;
+	case expr_type::E_VAR:
+	case expr_type::E_PLUS:
+	case expr_type::E_BANG:
+	case expr_type::E_BUILTIN:
+	case expr_type::E_BU_1MATH:
+	case expr_type::E_BU_2MATH:
+	case expr_type::E_RETURN:
+	case expr_type::E_NCLASSES:
+		NOT_REACHED;
+	}
+}
+
+/* the copy is also what is printed */
+static Branch *
+spec_branches(Branch *branch, int local)
+{
+	if (branch == nullptr)
+		return nullptr;
+	return new_branch(branch->br_formals,
+		spec_copy(branch->br_body, local),
+		spec_branches(branch->br_next, local));
+}
+
+/*
+ *	Full laziness and common subexpressions.
+ *	A subexpression is bound with
+ *
+ *		let v == sub in expr'
+ *
+ *	where expr' is expr with each occurrence of sub replaced by v.
+ *	Lambdas are treated inside out, so that an expression floated out
+ *	of an inner lambda may be floated further out of an outer one.
+ */
+static Expr *
+hoist(Expr *expr)
+{
+	Expr	*node;
+
+	switch (expr->e_class) {
+	case expr_type::E_PAIR:
+		expr->e_left = hoist(expr->e_left);
+		expr->e_right = hoist(expr->e_right);
+		return expr;
+	case expr_type::E_APPLY:
+	case expr_type::E_IF:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+		for (node = expr; ; node = node->e_func) {
+			node->e_arg = hoist(node->e_arg);
+			if (! IsApply(node->e_func))
+				break;
+		}
+		node->e_func = hoist(node->e_func);
+		return expr;
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+		hoist_branches(expr->e_func->e_branch);
+		expr->e_arg = hoist(expr->e_arg);
+		return expr;
+	case expr_type::E_MU:
+		expr->e_body = hoist(expr->e_body);
+		return expr;
+	case expr_type::E_LAMBDA:
+		hoist_branches(expr->e_branch);
+		return float_out(expr, 0);
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		hoist_branches(expr->e_branch);
+		return expr;
+	case expr_type::E_NUM:
+	case expr_type::E_CHAR:
+	case expr_type::E_CONS:
+	case expr_type::E_DEFUN:
+	case expr_type::E_PARAM:
+		return expr;
+	case expr_type::E_VAR:
+	case expr_type::E_PLUS:
+	case expr_type::E_BANG:
+	case expr_type::E_BUILTIN:
+	case expr_type::E_BU_1MATH:
+	case expr_type::E_BU_2MATH:
+	case expr_type::E_RETURN:
+	case expr_type::E_NCLASSES:
+		NOT_REACHED;
+	}
+}
+
+/* as in simp_branches(), the originals are left alone */
+static void
+hoist_branches(Branch *branch)
+{
+	for ( ; branch != nullptr; branch = branch->br_next) {
+		if (branch->br_body == branch->br_expr)
+			branch->br_body = lift(branch->br_body, 0, 0);
+		branch->br_body = hoist(branch->br_body);
+	}
+}
+
+/*
+ *	Float invariant subexpressions out of lambda, after n others,
+ *	and then share common ones within its branches.
+ */
+static Expr *
+float_out(Expr *lambda, int n)
+{
+	Expr	*sub;
+
+	if (n < MAX_FLOAT &&
+	    (sub = mov_branches(lambda->e_branch, lambda->e_arity,
+				nullptr)) != nullptr &&
+	    affordable(lambda))
+		return let_expr(new_var(), sub,
+			float_out(abstract(lambda, 0, sub), n+1), FALSE);
+	for (auto br = lambda->e_branch; br != nullptr; br = br->br_next)
+		br->br_body = share(br->br_body, 0);
+	return lambda;
+}
+
+/* bind subexpressions occurring more than once in body, after n others */
+static Expr *
+share(Expr *body, int n)
+{
+	Expr	*sub;
+
+	if (n < MAX_SHARE && (sub = movable(body, 0, body)) != nullptr &&
+	    affordable(body))
+		return let_expr(new_var(), sub,
+			share(abstract(body, 0, sub), n+1), FALSE);
+	return body;
+}
+
+/*
+ *	Whether expr may be copied by abstract(), within what remains of
+ *	FLOAT_BUDGET.  Each copy of a lambda includes the lets already
+ *	floated out of the lambdas within it, so without a limit deeply
+ *	nested lambdas could take a lot of space.
+ */
+static Bool
+affordable(Expr *expr)
+{
+	auto n = size(expr, float_budget);
+	if (n > float_budget)
+		return FALSE;
+	float_budget -= n;
+	return TRUE;
+}
+
+/*
+ *	A subexpression of expr, nested within local scopes of the place
+ *	where it is to be bound, that refers only to variables outside
+ *	those scopes, moved out to that place.  If body is not null, the
+ *	subexpression must also occur more than once in it.
+ *	The bodies of lambdas (inside the scopes) are not searched, since
+ *	that would not save any work.
+ */
+static Expr *
+movable(Expr *expr, int local, Expr *body)
+{
+	Expr	*sub;
+
+	if (expr->e_class == expr_type::E_APPLY &&
+	    closed(expr, local) && flat(expr)) {
+		sub = lift(expr, 0, -local);
+		if (body == nullptr || occurrences(body, 0, sub) > 1)
+			return sub;
+	}
+	switch (expr->e_class) {
+	case expr_type::E_PAIR:
+	case expr_type::E_APPLY:
+	case expr_type::E_IF:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+		return (sub = movable(expr->e_left, local, body)) != nullptr ?
+			sub : movable(expr->e_right, local, body);
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+		return (sub = mov_branches(expr->e_func->e_branch, local+1,
+						body)) != nullptr ?
+			sub : movable(expr->e_arg, local+1, body);
+	case expr_type::E_MU:
+		return movable(expr->e_body, local+1, body);
+	case expr_type::E_EQN:
+		return mov_branches(expr->e_branch, local + expr->e_arity,
+					body);
+	default:
+		return nullptr;
+	}
+}
+
+static Expr *
+mov_branches(Branch *branch, int local, Expr *body)
+{
+	Expr	*sub;
+
+	for ( ; branch != nullptr; branch = branch->br_next)
+		if ((sub = movable(branch->br_body, local, body)) != nullptr)
+			return sub;
+	return nullptr;
+}
+
+/*
+ * The number of occurrences of sub, moved in by local scopes, in expr,
+ * that may be evaluated together: of the limbs of a conditional, only
+ * the one with more.
+ */
+static int
+occurrences(Expr *expr, int local, Expr *sub)
+{
+	int	n, m;
+
+	if (same(expr, sub, local))
+		return 1;
+	switch (expr->e_class) {
+	case expr_type::E_IF:
+		n = occurrences(expr->e_func->e_arg, local, sub);
+		m = occurrences(expr->e_arg, local, sub);
+		return occurrences(expr->e_func->e_func->e_arg, local, sub) +
+			(n > m ? n : m);
+	case expr_type::E_PAIR:
+	case expr_type::E_APPLY:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+		return occurrences(expr->e_left, local, sub) +
+			occurrences(expr->e_right, local, sub);
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+		n = occurrences(expr->e_arg, local+1, sub);
+		for (auto br = expr->e_func->e_branch;
+		     br != nullptr;
+		     br = br->br_next)
+			n += occurrences(br->br_body, local+1, sub);
+		return n;
+	case expr_type::E_MU:
+		return occurrences(expr->e_body, local+1, sub);
+	case expr_type::E_LAMBDA:
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		n = 0;
+		for (auto br = expr->e_branch; br != nullptr; br = br->br_next)
+			n += occurrences(br->br_body, local + expr->e_arity,
+						sub);
+		return n;
+	default:
+		return 0;
+	}
+}
+
+/*
+ *	A copy of expr (nested within local scopes of its own) within the
+ *	scope of a new variable, to which each occurrence of sub refers.
+ */
+static Expr *
+abstract(Expr *expr, int local, Expr *sub)
+{
+	Expr	*copy;
+
+	if (same(expr, sub, local)) {
+		copy = NEW(Expr);
+		copy->e_used = ENV_ALL;
+		copy->e_class = expr_type::E_PARAM;
+		copy->e_level = local;
+		copy->e_once = FALSE;
+		copy->e_patt = new_var();
+		copy->e_where = copy->e_patt->e_dirs;
+		return copy;
+	}
+	switch (expr->e_class) {
+	case expr_type::E_PARAM:
+		return lift(expr, local, 1);
+	case expr_type::E_PAIR:
+		return pair_expr(abstract(expr->e_left, local, sub),
+				abstract(expr->e_right, local, sub));
+	case expr_type::E_APPLY:
+	case expr_type::E_IF:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+		copy = copy_node(expr);
+		copy->e_func = abstract(expr->e_func, local, sub);
+		copy->e_arg = abstract(expr->e_arg, local, sub);
+		return copy;
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+		copy = copy_node(expr);
+		copy->e_func = copy_node(expr->e_func);
+		copy->e_func->e_branch = abs_branches(expr->e_func->e_branch,
+						local+1, sub);
+		copy->e_arg = abstract(expr->e_arg, local+1, sub);
+		return copy;
+	case expr_type::E_MU:
+		copy = copy_node(expr);
+		copy->e_body = abstract(expr->e_body, local+1, sub);
+		return copy;
+	case expr_type::E_LAMBDA:
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		copy = copy_node(expr);
+		copy->e_branch = abs_branches(expr->e_branch,
+					local + expr->e_arity, sub);
+		return copy;
+	case expr_type::E_NUM:
+	case expr_type::E_CHAR:
+	case expr_type::E_CONS:
+	case expr_type::E_DEFUN:
+		return expr;
+	case expr_type::E_VAR:
+	case expr_type::E_PLUS:
+	case expr_type::E_BANG:
+	case expr_type::E_BUILTIN:
+	case expr_type::E_BU_1MATH:
+	case expr_type::E_BU_2MATH:
+	case expr_type::E_RETURN:
+	case expr_type::E_NCLASSES:
+		NOT_REACHED;
+	}
+}
+
+/* the originals are only moved, for printing */
+static Branch *
+abs_branches(Branch *branch, int local, Expr *sub)
+{
+	if (branch == nullptr)
+		return nullptr;
+	auto copy = new_branch(branch->br_formals,
+			abstract(branch->br_body, local, sub),
+			abs_branches(branch->br_next, local, sub));
+	if (branch->br_expr != branch->br_body)
+		copy->br_expr = lift(branch->br_expr, local, 1);
+	return copy;
+}
+
+/* a variable bound by a let introduced here */
+static Expr *
+new_var(void)
+{
+static	String	name;
+
+	if (name == nullptr)
+		name = newstring("_");
+	auto var = id_expr(name);
+	var->e_dirs = p_stash(p_new());
+	return var;
+}
+
+/*
+ *	Substitution of arguments for the variables of a body.
+ *	The body is nested within outer scopes shared with the place it is
+ *	moved to, and nargs scopes for the arguments, which are removed.
+ */
+static	int	sub_outer;
+static	int	sub_nargs;
+static	Expr	**sub_args;
+static	Expr	*sub_uses[MAX_USES];	/* costly arguments substituted */
+static	int	sub_nuses;
+static	Bool	sub_failed;
+static	Bool	sub_printing;	/* substituting in an original for printing */
+
+static Expr *
+substitute(Expr *body, int outer, int nargs, Expr **args)
+{
+	sub_outer = outer;
+	sub_nargs = nargs;
+	sub_args = args;
+	sub_nuses = 0;
+	sub_failed = FALSE;
+	body = subst(body, 0, FALSE);
+	return sub_failed ? nullptr : body;
+}
+
+/*
+ *	A copy of expr (nested within local scopes of the body) with the
+ *	arguments substituted.
+ */
+static Expr *
+subst(Expr *expr, int local, Bool under_lambda)
+{
+	Expr	*arg;
+	int	scope;
+
+	if (sub_failed)
+		return expr;
+	switch (expr->e_class) {
+	case expr_type::E_PARAM:
+		/* the scope it refers to, outermost first */
+		scope = sub_outer + sub_nargs + local - 1 - expr->e_level;
+		if (scope >= sub_outer + sub_nargs)	/* inside the body */
+			return expr;
+		if (scope < sub_outer) {		/* outside */
+			expr = copy_node(expr);
+			expr->e_level -= sub_nargs;
+			return expr;
+		}
+		arg = resolve(sub_args[scope - sub_outer], expr->e_where);
+		if (arg == nullptr) {
+			sub_failed = TRUE;
+			return expr;
+		}
+		if (! cheap(arg) && ! sub_printing) {
+			if (under_lambda || sub_nuses == MAX_USES) {
+				sub_failed = TRUE;
+				return expr;
+			}
+			for (int i = 0; i < sub_nuses; i++)
+				if (contains(sub_uses[i], arg) ||
+				    contains(arg, sub_uses[i])) {
+					sub_failed = TRUE;
+					return expr;
+				}
+			sub_uses[sub_nuses++] = arg;
+		}
+		return lift(arg, 0, local);
+	case expr_type::E_PAIR:
+		return pair_expr(subst(expr->e_left, local, under_lambda),
+				subst(expr->e_right, local, under_lambda));
+	case expr_type::E_APPLY:
+	case expr_type::E_IF:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+		arg = copy_node(expr);
+		arg->e_func = subst(expr->e_func, local, under_lambda);
+		arg->e_arg = subst(expr->e_arg, local, under_lambda);
+		return arg;
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+		arg = copy_node(expr);
+		arg->e_func = copy_node(expr->e_func);
+		arg->e_func->e_branch = subst_branches(expr->e_func->e_branch,
+						local, 1, under_lambda);
+		arg->e_arg = subst(expr->e_arg, local+1, under_lambda);
+		return arg;
+	case expr_type::E_MU:
+		arg = copy_node(expr);
+		arg->e_body = subst(expr->e_body, local+1, under_lambda);
+		return arg;
+	case expr_type::E_EQN:	/* applied once, by a let or where */
+		arg = copy_node(expr);
+		arg->e_branch = subst_branches(expr->e_branch, local,
+					expr->e_arity, under_lambda);
+		return arg;
+	case expr_type::E_LAMBDA:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		arg = copy_node(expr);
+		arg->e_branch = subst_branches(expr->e_branch, local,
+					expr->e_arity, TRUE);
+		return arg;
+	case expr_type::E_NUM:
+	case expr_type::E_CHAR:
+	case expr_type::E_CONS:
+	case expr_type::E_DEFUN:
+		return expr;
+	case expr_type::E_VAR:
+	case expr_type::E_PLUS:
+	case expr_type::E_BANG:
+	case expr_type::E_BUILTIN:
+	case expr_type::E_BU_1MATH:
+	case expr_type::E_BU_2MATH:
+	case expr_type::E_RETURN:
+	case expr_type::E_NCLASSES:
+		NOT_REACHED;
+	}
+}
+
+static Branch *
+subst_branches(Branch *branch, int local, int arity, Bool under_lambda)
+{
+	if (branch == nullptr)
+		return nullptr;
+	auto copy = new_branch(branch->br_formals,
+			subst(branch->br_body, local+arity, under_lambda),
+			subst_branches(branch->br_next, local, arity,
+				under_lambda));
+	if (branch->br_expr != branch->br_body) {
+		/* the original, for printing only */
+		auto printing = sub_printing;
+		sub_printing = TRUE;
+		copy->br_expr = subst(branch->br_expr, local+arity, TRUE);
+		sub_printing = printing;
+	}
+	return copy;
+}
+
+/*
+ *	A copy of expr (nested within local scopes of its own), with
+ *	references to variables outside it moved out by shift scopes.
+ */
+static Expr *
+lift(Expr *expr, int local, int shift)
+{
+	Expr	*copy;
+
+	switch (expr->e_class) {
+	case expr_type::E_PARAM:
+		if (shift == 0 || expr->e_level < local)
+			return expr;
+		copy = copy_node(expr);
+		copy->e_level += shift;
+		return copy;
+	case expr_type::E_PAIR:
+		return pair_expr(lift(expr->e_left, local, shift),
+				lift(expr->e_right, local, shift));
+	case expr_type::E_APPLY:
+	case expr_type::E_IF:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+		copy = copy_node(expr);
+		copy->e_func = lift(expr->e_func, local, shift);
+		copy->e_arg = lift(expr->e_arg, local, shift);
+		return copy;
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+		copy = copy_node(expr);
+		copy->e_func = copy_node(expr->e_func);
+		copy->e_func->e_branch = lift_branches(expr->e_func->e_branch,
+						local+1, shift);
+		copy->e_arg = lift(expr->e_arg, local+1, shift);
+		return copy;
+	case expr_type::E_MU:
+		copy = copy_node(expr);
+		copy->e_body = lift(expr->e_body, local+1, shift);
+		return copy;
+	case expr_type::E_LAMBDA:
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		copy = copy_node(expr);
+		copy->e_branch = lift_branches(expr->e_branch,
+					local + expr->e_arity, shift);
+		return copy;
+	case expr_type::E_NUM:
+	case expr_type::E_CHAR:
+	case expr_type::E_CONS:
+	case expr_type::E_DEFUN:
+		return expr;
+	case expr_type::E_VAR:
+	case expr_type::E_PLUS:
+	case expr_type::E_BANG:
+	case expr_type::E_BUILTIN:
+	case expr_type::E_BU_1MATH:
+	case expr_type::E_BU_2MATH:
+	case expr_type::E_RETURN:
+	case expr_type::E_NCLASSES:
+		NOT_REACHED;
+	}
+}
+
+static Branch *
+lift_branches(Branch *branch, int local, int shift)
+{
+	if (branch == nullptr)
+		return nullptr;
+	auto copy = new_branch(branch->br_formals,
+			lift(branch->br_body, local, shift),
+			lift_branches(branch->br_next, local, shift));
+	if (branch->br_expr != branch->br_body)
+		copy->br_expr = lift(branch->br_expr, local, shift);
+	return copy;
+}
+
+static Expr *
+copy_node(Expr *expr)
+{
+	auto copy = NEW(Expr);
+	*copy = *expr;
+	if (IsApply(copy))
+		copy->e_strict = 0;
+	return copy;
+}
+
+/*
+ *	Properties of expressions.
+ */
+
+/* expr may be duplicated without repeating work */
+static Bool
+cheap(Expr *expr)
+{
+	switch (expr->e_class) {
+	case expr_type::E_NUM:
+	case expr_type::E_CHAR:
+	case expr_type::E_CONS:
+	case expr_type::E_DEFUN:
+	case expr_type::E_PARAM:
+		return TRUE;
+	case expr_type::E_PAIR:
+		return cheap(expr->e_left) && cheap(expr->e_right);
+	default:
+		return FALSE;
+	}
+}
+
+static Bool
+contains(Expr *expr, Expr *sub)
+{
+	if (expr == sub)
+		return TRUE;
+	switch (expr->e_class) {
+	case expr_type::E_PAIR:
+	case expr_type::E_APPLY:
+	case expr_type::E_IF:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+		return contains(expr->e_left, sub) ||
+			contains(expr->e_right, sub);
+	case expr_type::E_MU:
+		return contains(expr->e_body, sub);
+	case expr_type::E_LAMBDA:
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		for (auto br = expr->e_branch; br != nullptr; br = br->br_next)
+			if (contains(br->br_body, sub))
+				return TRUE;
+		return FALSE;
+	default:
+		return FALSE;
+	}
+}
+
+/*
+ * expr is a function value that may be duplicated without repeating work:
+ * a lambda (whose body is evaluated at each call anyway), or a partial
+ * application of a function or constructor to such values.
+ */
+static Bool
+known(Expr *expr)
+{
+	int	n;
+
+	switch (expr->e_class) {
+	case expr_type::E_LAMBDA:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		return TRUE;
+	case expr_type::E_DEFUN:
+		return expr->e_defun->f_arity > 0;
+	case expr_type::E_CONS:
+		return expr->e_const->c_nargs > 0;
+	case expr_type::E_APPLY:
+		for (n = 0; expr->e_class == expr_type::E_APPLY;
+		     expr = expr->e_func, n++)
+			if (! cheap(expr->e_arg) && ! known(expr->e_arg))
+				return FALSE;
+		return expr->e_class == expr_type::E_DEFUN ?
+				n < expr->e_defun->f_arity :
+			expr->e_class == expr_type::E_CONS ?
+				n < expr->e_const->c_nargs :
+			FALSE;
+	default:
+		return FALSE;
+	}
+}
+
+/* the number of nodes in expr, counting up to just past limit */
+static int
+size(Expr *expr, int limit)
+{
+	int	n;
+
+	switch (expr->e_class) {
+	case expr_type::E_PAIR:
+	case expr_type::E_APPLY:
+	case expr_type::E_IF:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+		n = 1 + size(expr->e_left, limit);
+		return n > limit ? n : n + size(expr->e_right, limit - n);
+	case expr_type::E_MU:
+		return 1 + size(expr->e_body, limit-1);
+	case expr_type::E_LAMBDA:
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		n = 1;
+		for (auto br = expr->e_branch;
+		     br != nullptr && n <= limit;
+		     br = br->br_next)
+			n += size(br->br_body, limit - n);
+		return n;
+	default:
+		return 1;
+	}
+}
+
+static Bool
+calls(Expr *expr, Func *fn)
+{
+	switch (expr->e_class) {
+	case expr_type::E_DEFUN:
+		return expr->e_defun == fn;
+	case expr_type::E_PAIR:
+	case expr_type::E_APPLY:
+	case expr_type::E_IF:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+		return calls(expr->e_left, fn) || calls(expr->e_right, fn);
+	case expr_type::E_MU:
+		return calls(expr->e_body, fn);
+	case expr_type::E_LAMBDA:
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		for (auto br = expr->e_branch; br != nullptr; br = br->br_next)
+			if (calls(br->br_body, fn))
+				return TRUE;
+		return FALSE;
+	default:
+		return FALSE;
+	}
+}
+
+/*
+ * syntactic equality of (usually small) expressions, where e1 is e2
+ * moved in by shift scopes
+ */
+static Bool
+same(Expr *e1, Expr *e2, int shift)
+{
+	if (e1->e_class != e2->e_class)
+		return FALSE;
+	switch (e1->e_class) {
+	case expr_type::E_NUM:
+		return e1->e_num == e2->e_num;
+	case expr_type::E_CHAR:
+		return e1->e_char == e2->e_char;
+	case expr_type::E_CONS:
+		return e1->e_const == e2->e_const;
+	case expr_type::E_DEFUN:
+		return e1->e_defun == e2->e_defun;
+	case expr_type::E_PARAM:
+		return e1->e_level == e2->e_level + shift &&
+			p_equal(e1->e_where, e2->e_where);
+	case expr_type::E_PAIR:
+	case expr_type::E_APPLY:
+		return same(e1->e_left, e2->e_left, shift) &&
+			same(e1->e_right, e2->e_right, shift);
+	default:
+		return FALSE;
+	}
+}
+
+/*
+ * expr is built from applications, pairs and atoms (as compared by
+ * same()), and refers to no variable in the innermost local scopes
+ */
+static Bool
+closed(Expr *expr, int local)
+{
+	switch (expr->e_class) {
+	case expr_type::E_NUM:
+	case expr_type::E_CHAR:
+	case expr_type::E_CONS:
+	case expr_type::E_DEFUN:
+		return TRUE;
+	case expr_type::E_PARAM:
+		return expr->e_level >= local;
+	case expr_type::E_PAIR:
+	case expr_type::E_APPLY:
+		return closed(expr->e_left, local) &&
+			closed(expr->e_right, local);
+	default:
+		return FALSE;
+	}
+}
+
+/*
+ * expr is a full application of a declared function whose values are
+ * of bounded size: numbers, characters or enumerations
+ */
+static Bool
+flat(Expr *expr)
+{
+	Type	*type;
+	int	n;
+
+	for (n = 0; expr->e_class == expr_type::E_APPLY; expr = expr->e_func)
+		n++;
+	if (expr->e_class != expr_type::E_DEFUN ||
+	    ! expr->e_defun->f_explicit_dec)
+		return FALSE;
+	for (type = expr->e_defun->f_type; ; type = type->ty_secondarg) {
+		while (type->ty_class == TY_CONS &&
+		       IsSynType(type->ty_deftype) &&
+		       type->ty_deftype->dt_arity == 0)
+			type = type->ty_deftype->dt_type;
+		if (type->ty_class != TY_CONS)
+			return FALSE;
+		if (n-- == 0)
+			break;
+		if (type->ty_deftype != function)
+			return FALSE;
+	}
+	if (type->ty_deftype == num || type->ty_deftype == character)
+		return TRUE;
+	if (! IsDataType(type->ty_deftype))
+		return FALSE;
+	for (auto c = type->ty_deftype->dt_cons; c != nullptr; c = c->c_next)
+		if (c->c_nargs > 0)
+			return FALSE;
+	return TRUE;
+}
+
+static Bool
+IsApply(Expr *expr)
+{
+	return expr->e_class == expr_type::E_APPLY ||
+		expr->e_class == expr_type::E_IF ||
+		expr->e_class == expr_type::E_LET ||
+		expr->e_class == expr_type::E_WHERE;
+}
@@ -0,0 +1,20 @@
+#ifndef SIMPLIFY_H
+#define SIMPLIFY_H
+
+#include "defs.h"
+#include "newstring.h"
+
+/*
+ * A simplified copy of expr, which is nested within depth scopes,
+ * to be compiled in its place (cf simplify.c).
+ * The original is kept for display.
+ */
+extern	Expr	*simplify(Expr *expr, int depth);
+
+/*
+ * The named module has been completely read:
+ * note any of its functions that take part in fusion of list pipelines.
+ */
+extern	void	fuse_module(String name);
+
+#endif
@@ -0,0 +1,151 @@
+#include "defs.h"
+#include "sort.h"
+#include "array.h"
+#include "compare.h"
+#include "expr.h"
+#include "path.h"
+#include "value.h"
+#include "stack.h"
+#include "interpret.h"
+
+/*
+ *	Sorting.
+ *	The spine of the list is evaluated and its elements collected in a
+ *	block, which is sorted by a stable merge sort, and converted back
+ *	to a list.  The elements are compared directly as far as they are
+ *	already evaluated, and otherwise by compare (or the function
+ *	given), which evaluates them only as far as it needs to.
+ */
+
+#define	RUN	8	/* length of runs sorted by insertion */
+
+/*
+ *	An ordering of two elements, returning <0, 0 or >0,
+ *	given the function passed to sort_by, if any.
+ */
+typedef	int	Order(Cell *first, Cell *second, Cell *fn);
+
+static Expr	*e_order;	/* fn (first, second), cf by_function() */
+
+static Cell	*sort_list(Cell *list, Order *order, Cell *fn);
+static void	insertion_sort(Cell **a, int lo, int hi,
+				Order *order, Cell *fn);
+static void	merge(Cell **from, Cell **to, int lo, int mid, int hi,
+				Order *order, Cell *fn);
+static int	by_value(Cell *first, Cell *second, Cell *fn);
+static int	by_function(Cell *first, Cell *second, Cell *fn);
+
+void
+init_sort(void)
+{
+	e_order = apply_expr(dir_expr(p_push(P_LEFT, p_new())),
+			     dir_expr(p_push(P_RIGHT, p_new())));
+}
+
+Cell *
+sort(Cell *list)
+{
+	return sort_list(list, by_value, NOCELL);
+}
+
+Cell *
+sort_by(Cell *arg)
+{
+	chk_stack(1);
+	Push(arg);
+	auto result = sort_list(arg->c_right, by_function, arg->c_left);
+	Pop_void();
+	return result;
+}
+
+/*
+ *	The elements are kept reachable throughout, as comparisons may
+ *	collect garbage: the block being sorted and a copy of it, to merge
+ *	into, are both held in arrays on the stack, and elements are only
+ *	moved within one of them while the other holds them all.
+ */
+static Cell *
+sort_list(Cell *list, Order *order, Cell *fn)
+{
+	chk_stack(2);
+	auto array = list2array(list);
+	Push(array);
+	auto n = array->c_size;
+	chk_heap(NOCELL, 1);
+	auto copy = new_array(new_block(n, sizeof(Cell *)), 0, n);
+	Push(copy);
+	auto a = array->c_block->a_elt;
+	auto b = copy->c_block->a_elt;
+	(void)memcpy(b, a, n*sizeof(Cell *));
+	for (int lo = 0; lo < n; lo += RUN)
+		insertion_sort(a, lo, lo + RUN < n ? lo + RUN : n, order, fn);
+	for (int width = RUN; width < n; width *= 2) {
+		for (int lo = 0; lo < n; lo += 2*width) {
+			auto mid = lo + width < n ? lo + width : n;
+			auto hi = mid + width < n ? mid + width : n;
+			merge(a, b, lo, mid, hi, order, fn);
+		}
+		auto t = a;
+		a = b;
+		b = t;
+	}
+	chk_heap(NOCELL, ListCells(n));
+	Pop_void();
+	Pop_void();
+	return array_list(a == array->c_block->a_elt ? array : copy);
+}
+
+static void
+insertion_sort(Cell **a, int lo, int hi, Order *order, Cell *fn)
+{
+	for (int i = lo + 1; i < hi; i++) {
+		auto x = a[i];
+		int	j;
+		for (j = i; j > lo && (*order)(a[j-1], x, fn) > 0; j--)
+			a[j] = a[j-1];
+		a[j] = x;
+	}
+}
+
+/*
+ *	Merge the ordered runs from[lo..mid-1] and from[mid..hi-1] into
+ *	to[lo..hi-1], taking equal elements from the first run first.
+ */
+static void
+merge(Cell **from, Cell **to, int lo, int mid, int hi,
+	Order *order, Cell *fn)
+{
+	int	i, j, k;
+
+	/* already in order, as often happens */
+	if (mid == hi ||
+	    (*order)(from[mid-1], from[mid], fn) <= 0) {
+		(void)memcpy(to + lo, from + lo, (hi - lo)*sizeof(Cell *));
+		return;
+	}
+	for (i = lo, j = mid, k = lo; i < mid && j < hi; k++)
+		if ((*order)(from[j], from[i], fn) < 0)
+			to[k] = from[j++];
+		else
+			to[k] = from[i++];
+	while (i < mid)
+		to[k++] = from[i++];
+	while (j < hi)
+		to[k++] = from[j++];
+}
+
+/*ARGSUSED*/
+static int
+by_value(Cell *first, Cell *second, Cell *)
+{
+	return compare_values(first, second);
+}
+
+static int
+by_function(Cell *first, Cell *second, Cell *fn)
+{
+	chk_heap(NOCELL, 4);
+	return relation_sign(head_evaluate(new_susp(e_order,
+			new_pair(new_pair(fn, new_pair(first, second)),
+				 NOCELL))));
+}
@@ -0,0 +1,17 @@
+#ifndef SORT_H
+#define SORT_H
+
+/*
+ *	Sorting lists, in a block of cells (cf array.h).
+ */
+
+#include "defs.h"
+
+/* Call after reading standard module. */
+extern	void	init_sort(void);
+
+/* the built-in functions */
+extern	Cell	*sort(Cell *list);
+extern	Cell	*sort_by(Cell *arg);
+
+#endif
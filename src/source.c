@@ -8,6 +8,7 @@
 #include "error.h"
 #include "interrupt.h"
 #include "exceptions.h"
+#include "output.h"
 
 #define	MAX_DEPTH	16	/* max. depth of module nesting (checked) */
 #define	MAX_LINE	1024	/* max. length of input line (checked) */
@@ -113,6 +114,7 @@ init_source(FILE *src, Bool listing_flag)
 void
 start_err_line(void)
 {
+	end_print();
 #ifdef	RE_EDIT
 	if (listing != cur_source && ! gen_listing) {
 		if (listing != nullptr) {
@@ -22,6 +22,8 @@ union	_StkElt {
 extern	StkElt	*stack;
 
 #define FORCE_MARK      NOCELL
+extern	Cell	eval_mark;
+#define	EVAL_MARK	(&eval_mark)	/* cf interpret.c */
 
 #define	Push(cell)	((--stack)->stk_value = (cell))
 #define	Pop()		(stack++->stk_value)
@@ -34,6 +36,8 @@ extern	StkElt	*stack;
  *	PushUpdate(cp)	push an update frame pointing to cp onto the stack.
  *	PopUpdate()	pop the update from on top of the stack, returning
  *			its cell pointer.
+ *	Updatee()	the cell pointer of the update frame on top of the
+ *			stack, which is left in place.
  *
  * Update frames on the stack consist of:
  *	a pointer to the cell to be updated.
@@ -53,6 +57,7 @@ extern	StkElt	*last_update;	/* top update frame */
 #define	PopUpdate() (\
 		last_update = stack++->stk_update,\
 		Pop())
+#define	Updatee()	(last_update[1].stk_value)
 
 extern	void	chk_stack(int required);
 
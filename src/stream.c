@@ -4,26 +4,54 @@
 #include "expr.h"
 #include "cons.h"
 #include "value.h"
+#include "heap.h"
 #include "builtin.h"
 
 #define	MAX_STREAMS	20	/* max. no. of streams (checked) */
 #define	MAX_FILENAME	100	/* max. len. of file name (checked) */
-#define	MAX_INPUTLINE	256	/* max. len. of tty input line (checked) */
+#define	MAX_INPUTLINE	65536	/* max. len. of tty input line (checked) */
+#define	STREAM_BLOCK	65536	/* size of each read from a file */
+#define	STREAM_CELLS	256	/* max. no. of string cells built at once */
+
+#ifdef UCS
+#define	MAX_CHARLEN	6	/* max. no. of bytes in a character (UTF) */
+#else
+#define	MAX_CHARLEN	1
+#endif
 
 /*
- * Table of open streams,
- * so we can close any left open at the end of evaluation.
+ * Streams are read in blocks, and each time a stream cell is entered,
+ * all the characters buffered (up to a limit) are returned at once,
+ * as a chain of packed string cells (cf value.h) followed by a new
+ * stream cell, so that the cost per character is small.  Reading
+ * never waits for more than the first character of a chain.
  */
-static FILE	*str_table[MAX_STREAMS];
 
-static int	get_one_char(void);
+/*
+ * Table of open streams, with their buffers,
+ * so we can close any left open at the end of evaluation.
+ */
+typedef	struct _Stream	Stream;
+struct _Stream {
+	FILE	*s_file;	/* nullptr if the slot is free */
+	Byte	*s_buf;		/* STREAM_BLOCK bytes, kept for reuse */
+	const	Byte	*s_ptr;	/* the bytes read but not yet used */
+	const	Byte	*s_end;
+	Bool	s_eof;
+};
+
+static Stream	str_table[MAX_STREAMS];
+
+static Bool	get_line(void);
+static Bool	fill_block(Stream *sp);
+static Cell	*pack_chars(const Byte **pp, const Byte *limit, Cell *rest);
 static void	end_stream(FILE *f);
 
 Cell *
 open_stream(Cell *arg)
 {
 	char	filename[MAX_FILENAME];
-	FILE	**fp;
+	Stream	*sp;
 
 	if (restricted)
 		error(EXECERR, "read function disabled");
@@ -31,81 +59,150 @@ open_stream(Cell *arg)
 	hope2c((Byte *)filename, MAX_FILENAME, arg);
 
 	/* find a free slot in the stream table */
-	for (fp = str_table; *fp != nullptr; fp++)
-		if (fp == &str_table[MAX_STREAMS])
+	for (sp = str_table; sp->s_file != nullptr; sp++)
+		if (sp == &str_table[MAX_STREAMS-1])
 			error(EXECERR, "stream table full");
+	if (sp->s_buf == nullptr &&
+	    (sp->s_buf = (Byte *)malloc(STREAM_BLOCK + MAX_CHARLEN)) ==
+			nullptr)
+		error(EXECERR, "can't allocate stream buffer");
 
 	/* try to open the file */
-	if ((*fp = fopen(filename, "r")) == nullptr)
+	if ((sp->s_file = fopen(filename, "r")) == nullptr)
 		error(EXECERR, "'%s': can't read file", filename);
-	return new_stream(*fp);
+	sp->s_ptr = sp->s_end = sp->s_buf;
+	sp->s_eof = FALSE;
+	return new_stream(sp->s_file);
 }
 
+/* the line most recently read from standard input, and how far it's used */
+static char	str_line[MAX_INPUTLINE];
+static const	Byte	*str_lptr, *str_lend;
+
+/*
+ *	The characters available on the stream, as a list ending with
+ *	the rest of the stream, or nil at the end.
+ *	Standard input gives the rest of the line last read.
+ */
 Cell *
 read_stream(Cell *cell)
 {
-	long	c;
-
-	c = cell->c_file == stdin ? get_one_char() : GetChar(cell->c_file);
-	if (c == EOF) {
-		end_stream(cell->c_file);
+	const	Byte	*limit;
+	Stream	*sp;
+
+	auto f = cell->c_file;
+	if (f == stdin) {
+		while (str_lptr >= str_lend)
+			if (! get_line())
+				return new_cnst(nil);
+		chk_heap(cell, STREAM_CELLS+1);
+		return pack_chars(&str_lptr, str_lend, new_stream(f));
+	}
+	for (sp = str_table; sp->s_file != f; sp++)
+		;
+	if (! fill_block(sp)) {
+		end_stream(f);
 		return new_cnst(nil);
 	}
-	return new_cons(cons,
-		new_pair(new_char((Char)c), new_stream(cell->c_file)));
+	/* leave an incomplete character for the next block */
+	limit = sp->s_eof ? sp->s_end : sp->s_end - (MAX_CHARLEN-1);
+	chk_heap(cell, STREAM_CELLS+1);
+	return pack_chars(&sp->s_ptr, limit, new_stream(f));
 }
 
-static char	str_line[MAX_INPUTLINE];
-static const	Byte	*str_lptr;
+/*
+ *	Pack the characters from *pp, up to those starting at limit,
+ *	into a chain of at most STREAM_CELLS string cells, followed by
+ *	rest.  There must be at least one character.
+ */
+static Cell *
+pack_chars(const Byte **pp, const Byte *limit, Cell *rest)
+{
+	SChar	chunk[STR_CHUNK];
+	Cell	*first, *last, *cp;
+	int	n;
+
+	first = last = NOCELL;
+	for (int ncells = 0; ncells < STREAM_CELLS && *pp < limit; ncells++) {
+		for (n = 0; n < (int)STR_CHUNK && *pp < limit; n++)
+			chunk[n] = (SChar)FetchChar(pp);
+		cp = new_string(chunk, n, NOCELL);
+		if (last == NOCELL)
+			first = cp;
+		else
+			last->c_rest = cp;
+		last = cp;
+	}
+	last->c_rest = rest;
+	return first;
+}
+
+/*
+ *	Read more of a file, if less than a whole character is buffered,
+ *	keeping what is left.  A read gets whatever is available (up to a
+ *	block), so that pipes are not held up.
+ *	Returns FALSE if nothing is left.
+ */
+static Bool
+fill_block(Stream *sp)
+{
+	long	left, n;
+
+	while (! sp->s_eof && sp->s_end - sp->s_ptr < MAX_CHARLEN) {
+		left = sp->s_end - sp->s_ptr;
+		(void)memmove(sp->s_buf, sp->s_ptr, left);
+		n = read(fileno(sp->s_file), sp->s_buf + left,
+			STREAM_BLOCK - left);
+		sp->s_ptr = sp->s_buf;
+		sp->s_end = sp->s_buf + left + (n > 0 ? n : 0);
+		sp->s_eof = n <= 0;
+	}
+	return sp->s_ptr < sp->s_end;
+}
 
 void
 reset_streams(void)
 {
-	FILE	**fp;
-
-	str_lptr = (const Byte *)"";
-	for (fp = str_table; fp != &str_table[MAX_STREAMS]; fp++)
-		*fp = nullptr;
+	str_lptr = str_lend = (const Byte *)"";
+	for (auto sp = str_table; sp != &str_table[MAX_STREAMS]; sp++)
+		sp->s_file = nullptr;
 }
 
 /*
  * Line-buffering for standard input, because if not all the input is used,
  * we want to discard the rest of the last line input.
  */
-static int
-get_one_char(void)
+static Bool
+get_line(void)
 {
-	if (*str_lptr == '\0') {
-		if (fgets(str_line, sizeof(str_line), stdin) == nullptr) {
-			clearerr(stdin);
-			return EOF;
-		}
-		str_lptr = (const Byte *)str_line;
+	if (fgets(str_line, sizeof(str_line), stdin) == nullptr) {
+		clearerr(stdin);
+		return FALSE;
 	}
-	return FetchChar(&str_lptr);
+	str_lptr = (const Byte *)str_line;
+	str_lend = str_lptr + strlen(str_line);
+	return TRUE;
 }
 
 static void
 end_stream(FILE *f)
 {
-	FILE	**fp;
+	Stream	*sp;
 
 	if (f != stdin) {
 		(void)fclose(f);
-		for (fp = str_table; *fp != f; fp++)
+		for (sp = str_table; sp->s_file != f; sp++)
 			;
-		*fp = nullptr;
+		sp->s_file = nullptr;
 	}
 }
 
 void
 close_streams(void)
 {
-	FILE	**fp;
-
-	for (fp = str_table; fp != &str_table[MAX_STREAMS]; fp++)
-		if (*fp != nullptr) {
-			(void)fclose(*fp);
-			*fp = nullptr;
+	for (auto sp = str_table; sp != &str_table[MAX_STREAMS]; sp++)
+		if (sp->s_file != nullptr) {
+			(void)fclose(sp->s_file);
+			sp->s_file = nullptr;
 		}
 }
@@ -0,0 +1,541 @@
+#include "defs.h"
+#include "strict.h"
+#include "expr.h"
+#include "unbox.h"
+#include "path.h"
+#include "memory.h"
+
+/*
+ *	Strictness analysis.
+ *
+ *	For each function defined by equations, find the positions in each
+ *	argument that are certainly evaluated whenever a full application
+ *	of the function is: those matched against constructors or numbers,
+ *	or demanded by the body, in every branch.  Recursive definitions
+ *	are handled by assuming at first that everything is demanded, and
+ *	weakening that until nothing changes.
+ *
+ *	Each application in the program is then marked with the positions
+ *	of its argument that are worth evaluating before the call, i.e.
+ *	those holding applications, so that recursive functions with
+ *	accumulating arguments don't build chains of suspensions
+ *	(cf interpret.c).  This only changes which of several errors or
+ *	non-terminations is seen.  Calls that may pass the parts of their
+ *	argument separately are marked at the same time (cf unbox.c).
+ *
+ *	Since definitions can be added in any order, the analysis is
+ *	redone for the whole program before an evaluation, if anything
+ *	has been defined since the last one.
+ */
+
+typedef	struct _DefList	DefList;
+struct _DefList {
+	Func	*dl_fn;
+	DefList	*dl_next;
+};
+
+static	DefList	*defined;	/* all functions defined by equations */
+static	Bool	stale;		/* something defined since last analysis */
+
+/*
+ * positions demanded in the variables of each scope, outermost first.
+ * Simplification may nest scopes more deeply than the source can; the
+ * analysis gives up on anything deeper (cf Fits()), finding no demand.
+ */
+typedef	Byte	Demand[MAX_SCOPES];
+
+#define	Fits(depth)	((depth) <= MAX_SCOPES)
+
+static Bool	fn_demand(Func *fn);
+static void	br_demand(Branch *branch, int depth, int arity, Byte *acc);
+static void	ex_demand(Expr *expr, int depth, Byte *d);
+static void	app_demand(Expr *expr, int depth, Byte *d);
+static void	arg_demand(Expr *arg, int pos, int mask, int depth, Byte *d);
+static Byte	patt_demand(Expr *pattern, int pos);
+static Byte	path_demand(Path where);
+static int	spine(Expr *expr, Expr **headp);
+static Bool	IsApply(Expr *expr);
+
+static void	mark_expr(Expr *expr, int depth);
+static void	mark_apply(Expr *expr, int depth);
+static void	mark_branches(Branch *branch, int depth);
+static Byte	eager_positions(Expr *arg, int pos, int mask);
+
+void
+st_define(Func *fn)
+{
+	if (fn->f_branch == nullptr) {	/* its first equation */
+		auto dl = NEW(DefList);
+		dl->dl_fn = fn;
+		dl->dl_next = defined;
+		defined = dl;
+	}
+	stale = TRUE;
+}
+
+void
+st_expr(Expr *expr)
+{
+	Bool	changed;
+
+	if (stale) {
+		for (auto dl = defined; dl != nullptr; dl = dl->dl_next)
+			for (int i = 0; i < MAX_STRICT_ARGS; i++)
+				dl->dl_fn->f_strict[i] = STRICT_ALL;
+		do {
+			changed = FALSE;
+			for (auto dl = defined; dl != nullptr; dl = dl->dl_next)
+				if (fn_demand(dl->dl_fn))
+					changed = TRUE;
+		} while (changed);
+		for (auto dl = defined; dl != nullptr; dl = dl->dl_next) {
+			mark_branches(dl->dl_fn->f_branch,
+				dl->dl_fn->f_arity);
+			if (dl->dl_fn->f_worker != nullptr)
+				mark_expr(dl->dl_fn->f_worker, 0);
+		}
+		stale = FALSE;
+	}
+	/* the top level expression has a variable: input */
+	mark_expr(expr, 1);
+}
+
+/*
+ *	Recompute the demand of fn on its arguments, returning TRUE if it
+ *	has changed.
+ */
+static Bool
+fn_demand(Func *fn)
+{
+	Demand	acc;
+	Bool	changed;
+
+	if (fn->f_branch == nullptr)
+		return FALSE;
+	br_demand(fn->f_branch, 0, fn->f_arity, acc);
+	changed = FALSE;
+	for (int i = 0; i < fn->f_arity && i < MAX_STRICT_ARGS; i++)
+		if (fn->f_strict[i] != acc[i]) {
+			fn->f_strict[i] = acc[i];
+			changed = TRUE;
+		}
+	return changed;
+}
+
+/*
+ *	The demand common to all the branches of a function or lambda,
+ *	applied to arity arguments at the given depth of nesting, in
+ *	acc[0..depth+arity-1].
+ */
+static void
+br_demand(Branch *branch, int depth, int arity, Byte *acc)
+{
+	Demand	d;
+	int	i;
+	Expr	*formals;
+
+	if (! Fits(depth+arity)) {
+		for (i = 0; i < MAX_SCOPES; i++)
+			acc[i] = 0;
+		return;
+	}
+	for (i = 0; i < depth+arity; i++)
+		acc[i] = STRICT_ALL;
+	for ( ; branch != nullptr; branch = branch->br_next) {
+		for (i = 0; i < depth+arity; i++)
+			d[i] = 0;
+		ex_demand(branch->br_body, depth+arity, d);
+		/* the last argument is the innermost scope */
+		i = depth+arity;
+		for (formals = branch->br_formals;
+		     formals != nullptr &&
+			formals->e_class == expr_type::E_APPLY;
+		     formals = formals->e_func)
+			d[--i] |= patt_demand(formals->e_arg, 1);
+		for (i = 0; i < depth+arity; i++)
+			acc[i] &= d[i];
+	}
+}
+
+/*
+ *	Add to d the positions in variables of the enclosing scopes that
+ *	are evaluated whenever expr is evaluated (to head normal form).
+ */
+static void
+ex_demand(Expr *expr, int depth, Byte *d)
+{
+	Demand	d1, d2;
+	int	i;
+
+	switch (expr->e_class) {
+	case expr_type::E_PARAM:
+		d[depth-1 - expr->e_level] |= path_demand(expr->e_where);
+		break;
+	case expr_type::E_IF:
+		/* the condition, and anything demanded by both limbs */
+		app_demand(expr, depth, d);
+		for (i = 0; i < depth; i++)
+			d1[i] = d2[i] = 0;
+		ex_demand(expr->e_func->e_arg, depth, d1);
+		ex_demand(expr->e_arg, depth, d2);
+		for (i = 0; i < depth; i++)
+			d[i] |= d1[i] & d2[i];
+		break;
+	case expr_type::E_APPLY:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+		app_demand(expr, depth, d);
+		break;
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+		if (! Fits(depth+1))
+			break;
+		for (i = 0; i <= depth; i++)
+			d1[i] = 0;
+		ex_demand(expr->e_func->e_branch->br_body, depth+1, d1);
+		for (i = 0; i < depth; i++)
+			d[i] |= d1[i];
+		break;
+	case expr_type::E_MU:
+		if (! Fits(depth+1))
+			break;
+		for (i = 0; i <= depth; i++)
+			d1[i] = 0;
+		ex_demand(expr->e_body, depth+1, d1);
+		for (i = 0; i < depth; i++)
+			d[i] |= d1[i];
+		break;
+	case expr_type::E_NUM:
+	case expr_type::E_CHAR:
+	case expr_type::E_CONS:
+	case expr_type::E_PAIR:
+	case expr_type::E_DEFUN:
+	case expr_type::E_LAMBDA:
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+	case expr_type::E_BUILTIN:
+	case expr_type::E_BU_1MATH:
+	case expr_type::E_BU_2MATH:
+	case expr_type::E_RETURN:
+		break;
+	case expr_type::E_VAR:
+	case expr_type::E_PLUS:
+	case expr_type::E_BANG:
+	case expr_type::E_NCLASSES:
+		NOT_REACHED;
+	}
+}
+
+/*
+ *	An application demands its function, and if that is a known
+ *	function or lambda applied to enough arguments, whatever that
+ *	demands of them.
+ */
+static void
+app_demand(Expr *expr, int depth, Byte *d)
+{
+	Expr	*head;
+	Demand	acc;
+	int	i;
+
+	auto n = spine(expr, &head);
+	switch (head->e_class) {
+	case expr_type::E_DEFUN:
+		if (n < head->e_defun->f_arity)
+			break;
+		for (i = n-1; i >= 0; i--, expr = expr->e_func)
+			if (i < head->e_defun->f_arity && i < MAX_STRICT_ARGS)
+				arg_demand(expr->e_arg, 1,
+					head->e_defun->f_strict[i], depth, d);
+		break;
+	case expr_type::E_LAMBDA:
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		if (n < head->e_arity || ! Fits(depth + head->e_arity))
+			break;
+		br_demand(head->e_branch, depth, head->e_arity, acc);
+		for (i = 0; i < depth; i++)
+			d[i] |= acc[i];
+		for (i = n-1; i >= 0; i--, expr = expr->e_func)
+			if (i < head->e_arity)
+				arg_demand(expr->e_arg, 1, acc[depth+i],
+					depth, d);
+		break;
+	case expr_type::E_PARAM:
+		ex_demand(head, depth, d);
+		break;
+	case expr_type::E_NUM:
+	case expr_type::E_CHAR:
+	case expr_type::E_CONS:
+	case expr_type::E_PAIR:
+	case expr_type::E_APPLY:
+	case expr_type::E_IF:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+	case expr_type::E_MU:
+	case expr_type::E_BUILTIN:
+	case expr_type::E_BU_1MATH:
+	case expr_type::E_BU_2MATH:
+	case expr_type::E_RETURN:
+		break;
+	case expr_type::E_VAR:
+	case expr_type::E_PLUS:
+	case expr_type::E_BANG:
+	case expr_type::E_NCLASSES:
+		NOT_REACHED;
+	}
+}
+
+/*
+ *	Add to d whatever is demanded by evaluating the positions of mask
+ *	in arg, which is at position pos.
+ */
+static void
+arg_demand(Expr *arg, int pos, int mask, int depth, Byte *d)
+{
+	if ((mask & StrictBit(pos)) == 0)
+		return;
+	if (arg->e_class == expr_type::E_PAIR && 2*pos < MAX_POS) {
+		arg_demand(arg->e_left, 2*pos, mask, depth, d);
+		arg_demand(arg->e_right, 2*pos+1, mask, depth, d);
+	} else
+		ex_demand(arg, depth, d);
+}
+
+/*
+ *	Positions matched by pattern, which is at position pos.
+ */
+static Byte
+patt_demand(Expr *pattern, int pos)
+{
+	Byte	sub;
+
+	switch (pattern->e_class) {
+	case expr_type::E_PAIR:
+		if (2*pos >= MAX_POS)
+			return patt_demand(pattern->e_left, pos) |
+				patt_demand(pattern->e_right, pos);
+		sub = patt_demand(pattern->e_left, 2*pos) |
+			patt_demand(pattern->e_right, 2*pos+1);
+		return sub == 0 ? 0 : sub | StrictBit(pos);
+	case expr_type::E_NUM:
+	case expr_type::E_CHAR:
+	case expr_type::E_CONS:
+	case expr_type::E_APPLY:
+	case expr_type::E_PLUS:
+		return StrictBit(pos);
+	case expr_type::E_BANG:
+		return patt_demand(pattern->e_rest, pos) | StrictBit(pos);
+	case expr_type::E_VAR:
+		return 0;
+	case expr_type::E_DEFUN:
+	case expr_type::E_LAMBDA:
+	case expr_type::E_PARAM:
+	case expr_type::E_MU:
+	case expr_type::E_IF:
+	case expr_type::E_WHERE:
+	case expr_type::E_LET:
+	case expr_type::E_RWHERE:
+	case expr_type::E_RLET:
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+	case expr_type::E_BUILTIN:
+	case expr_type::E_BU_1MATH:
+	case expr_type::E_BU_2MATH:
+	case expr_type::E_RETURN:
+	case expr_type::E_NCLASSES:
+		NOT_REACHED;
+	}
+}
+
+/*
+ *	Positions evaluated in getting a variable with path where
+ *	(cf p_reverse()).
+ */
+static Byte
+path_demand(Path where)
+{
+	int	pos;
+	Byte	bits;
+
+	pos = 1;
+	bits = StrictBit(pos);
+	for ( ; ! p_empty(where) && 2*pos < MAX_POS; where = p_pop(where))
+		switch (p_top(where)) {
+		case P_UNROLL:
+			break;
+		case P_LEFT:
+		case P_RIGHT:
+			pos = 2*pos + (p_top(where) == P_RIGHT);
+			bits |= StrictBit(pos);
+			break;
+		default:	/* inside a constructor */
+			return bits;
+		}
+	return bits;
+}
+
+/*
+ *	The number of arguments in the application expr, and its head.
+ */
+static int
+spine(Expr *expr, Expr **headp)
+{
+	int	n;
+
+	n = 0;
+	for ( ; IsApply(expr); expr = expr->e_func)
+		n++;
+	*headp = expr;
+	return n;
+}
+
+static Bool
+IsApply(Expr *expr)
+{
+	return expr->e_class == expr_type::E_APPLY ||
+		expr->e_class == expr_type::E_IF ||
+		expr->e_class == expr_type::E_LET ||
+		expr->e_class == expr_type::E_WHERE;
+}
+
+/*
+ *	Marking of applications.
+ */
+
+static void
+mark_expr(Expr *expr, int depth)
+{
+	switch (expr->e_class) {
+	case expr_type::E_PAIR:
+		mark_expr(expr->e_left, depth);
+		mark_expr(expr->e_right, depth);
+		break;
+	case expr_type::E_APPLY:
+	case expr_type::E_IF:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+		mark_apply(expr, depth);
+		break;
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+		mark_expr(expr->e_func->e_branch->br_body, depth+1);
+		mark_expr(expr->e_arg, depth+1);
+		break;
+	case expr_type::E_MU:
+		mark_expr(expr->e_body, depth+1);
+		break;
+	case expr_type::E_LAMBDA:
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		mark_branches(expr->e_branch, depth + expr->e_arity);
+		break;
+	case expr_type::E_NUM:
+	case expr_type::E_CHAR:
+	case expr_type::E_CONS:
+	case expr_type::E_DEFUN:
+	case expr_type::E_PARAM:
+	case expr_type::E_BUILTIN:
+	case expr_type::E_BU_1MATH:
+	case expr_type::E_BU_2MATH:
+	case expr_type::E_RETURN:
+		break;
+	case expr_type::E_VAR:
+	case expr_type::E_PLUS:
+	case expr_type::E_BANG:
+	case expr_type::E_NCLASSES:
+		NOT_REACHED;
+	}
+}
+
+static void
+mark_apply(Expr *expr, int depth)
+{
+	Expr	*head;
+	Demand	acc;
+	int	i;
+	Byte	*strict;
+	int	arity;
+
+	auto n = spine(expr, &head);
+	strict = nullptr;
+	arity = 0;
+	switch (head->e_class) {
+	case expr_type::E_DEFUN:
+		if (n >= head->e_defun->f_arity) {
+			strict = head->e_defun->f_strict;
+			arity = head->e_defun->f_arity < MAX_STRICT_ARGS ?
+				head->e_defun->f_arity : MAX_STRICT_ARGS;
+		}
+		break;
+	case expr_type::E_LAMBDA:
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		if (n >= head->e_arity && Fits(depth + head->e_arity)) {
+			br_demand(head->e_branch, depth, head->e_arity, acc);
+			strict = acc + depth;
+			arity = head->e_arity;
+		}
+		break;
+	default:
+		break;
+	}
+	for (i = n-1; i >= 0; i--, expr = expr->e_func) {
+		expr->e_strict = i < arity ?
+			eager_positions(expr->e_arg, 1, strict[i]) : 0;
+		expr->e_unboxed = i == 0 &&
+			head->e_class == expr_type::E_DEFUN &&
+			ub_call(head->e_defun, expr->e_arg);
+		mark_expr(expr->e_arg, depth);
+	}
+	mark_expr(head, depth);
+}
+
+static void
+mark_branches(Branch *branch, int depth)
+{
+	for ( ; branch != nullptr; branch = branch->br_next)
+		mark_expr(branch->br_body, depth);
+}
+
+/*
+ *	The positions of mask in arg (at position pos) that hold
+ *	applications, with their ancestors.
+ */
+static Byte
+eager_positions(Expr *arg, int pos, int mask)
+{
+	Byte	sub;
+
+	if ((mask & StrictBit(pos)) == 0)
+		return 0;
+	switch (arg->e_class) {
+	case expr_type::E_PAIR:
+		if (2*pos >= MAX_POS)
+			return 0;
+		sub = eager_positions(arg->e_left, 2*pos, mask) |
+			eager_positions(arg->e_right, 2*pos+1, mask);
+		return sub == 0 ? 0 : sub | StrictBit(pos);
+	case expr_type::E_APPLY:
+		/* a constructed value is already in head normal form */
+		if (arg->e_func->e_class == expr_type::E_CONS)
+			return 0;
+		return StrictBit(pos);
+	case expr_type::E_IF:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+	case expr_type::E_MU:
+		return StrictBit(pos);
+	default:
+		return 0;
+	}
+}
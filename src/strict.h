@@ -0,0 +1,30 @@
+#ifndef STRICT_H
+#define STRICT_H
+
+#include "defs.h"
+
+/*
+ *	Strictness analysis (cf strict.c).
+ *
+ *	The demand on an argument is the set of positions in it that are
+ *	certainly evaluated.  The positions form a tree: 1 is the whole
+ *	argument, and if the value at i is a pair, 2i and 2i+1 are its
+ *	left and right components, down to STRICT_DEPTH levels.
+ *	A demand always includes the ancestors of its positions.
+ */
+#define	STRICT_DEPTH	2
+#define	MAX_POS		(1<<(STRICT_DEPTH+1))	/* positions are 1..MAX_POS-1 */
+#define	StrictBit(pos)	(1<<((pos)-1))
+#define	STRICT_ALL	(StrictBit(MAX_POS)-1)	/* everything to full depth */
+
+/* a function has been (re)defined by an equation */
+extern	void	st_define(Func *fn);
+
+/*
+ * Bring the strictness of defined functions up to date, and mark
+ * the applications in them and in expr (at the top level) whose
+ * arguments may be evaluated before the call.
+ */
+extern	void	st_expr(Expr *expr);
+
+#endif
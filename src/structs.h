@@ -19,5 +19,6 @@ typedef	struct	_LCase	LCase;
 typedef	struct	_CharArray CharArray;
 
 typedef	struct	_Cell	Cell;
+typedef	struct	_Array	Array;
 
 #endif
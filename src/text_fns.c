@@ -0,0 +1,491 @@
+#include "defs.h"
+#include "text_fns.h"
+#include "char.h"
+#include "cons.h"
+#include "expr.h"
+#include "path.h"
+#include "value.h"
+#include "memory.h"
+#include "stack.h"
+#include "interpret.h"
+#include "error.h"
+
+/*
+ *	Native functions on text: those of the lines and words modules
+ *	(cf lib/lines.hop and lib/words.hop), which are defined as these,
+ *	and split, join and search (cf Standard).
+ *	The lists of lines, words, parts or positions are built as they
+ *	are used: each call yields one of them, and a suspension of the
+ *	same function for the rest.  The text is scanned a packed string
+ *	at a time where it can be, and each line, word or part is copied
+ *	into packed strings.
+ */
+
+/* special delimiters for scan() */
+#define	ANY_SPACE	((Char)~0)	/* any of those of isspace */
+#define	NO_CHAR		((Char)~0 - 1)	/* none: scan to the end */
+
+/* free cells needed for n characters as packed strings */
+#define	StrCells(n)	(((n) + STR_CHUNK-1)/STR_CHUNK)
+
+/*
+ *	A position in a list of characters: a cell of the list, and if it
+ *	is a STRING, the number of its characters passed.
+ *	The cells of a list are updated in place as it is evaluated, so
+ *	the cells from a list on the stack to a position in it are all
+ *	reachable, and stay where they are.
+ */
+typedef	struct {
+	Cell	*p_cell;
+	int	p_off;
+} Pos;
+
+static Expr	*e_lines;	/* text_lines applied to var 0, etc */
+static Expr	*e_unlines;
+static Expr	*e_words;
+static Expr	*e_split;
+static Expr	*e_join;
+static Expr	*e_search;
+
+static Expr	*apply_var(const char *name);
+static Bool	more(Pos *pp);
+static Bool	at_char(Pos *pp);
+static Char	peek_char(const Pos *pp);
+static void	pass_char(Pos *pp);
+static Cell	*rest_list(const Pos *pp);
+static Bool	delimits(Char c, Char delim);
+static long	scan(Pos *pp, Char delim);
+static Bool	matches(Pos pos, Cell *pattern);
+static Cell	*copy_chars(Pos *pp, long n, Cell *rest);
+
+void
+init_text(void)
+{
+	e_lines = apply_var("text_lines");
+	e_unlines = apply_var("text_unlines");
+	e_words = apply_var("text_words");
+	e_split = apply_var("split");
+	e_join = apply_var("join");
+	e_search = apply_var("text_search");
+}
+
+/* the function name (of the standard module) applied to var 0 */
+static Expr *
+apply_var(const char *name)
+{
+	auto fn = fn_lookup(newstring(name));
+	ASSERT( fn != nullptr );
+	auto fn_expr = NEW(Expr);
+	fn_expr->e_class = expr_type::E_DEFUN;
+	fn_expr->e_used = ENV_ALL;
+	fn_expr->e_defun = fn;
+	return apply_expr(fn_expr, dir_expr(p_new()));
+}
+
+/*
+ *	lines(text): the first line is evaluated and copied, up to the
+ *	newline, and the rest is another call, if there was a newline.
+ */
+Cell *
+text_lines(Cell *text)
+{
+	Pos	pos;
+	Cell	*rest;
+
+	chk_stack(1);
+	Push(text);
+	pos.p_cell = text;
+	pos.p_off = 0;
+	if (! more(&pos)) {
+		Pop_void();
+		return new_cnst(nil);
+	}
+	auto n = scan(&pos, '\n');
+	chk_heap(NOCELL, StrCells(n) + 6);
+	if (at_char(&pos)) {
+		pass_char(&pos);
+		rest = new_susp(e_lines, new_pair(rest_list(&pos), NOCELL));
+	} else	/* missing final newline */
+		rest = new_cnst(nil);
+	pos.p_cell = Pop();
+	pos.p_off = 0;
+	return new_cons(cons,
+		new_pair(copy_chars(&pos, n, new_cnst(nil)), rest));
+}
+
+/* unlines(l::ls): l is evaluated and copied, with a newline */
+Cell *
+text_unlines(Cell *lines)
+{
+	Pos	pos;
+	SChar	newline;
+
+	chk_stack(1);
+	Push(lines);
+	auto cp = head_evaluate(lines);
+	if (cp->c_class != C_CONS) {
+		Pop_void();
+		return new_cnst(nil);
+	}
+	auto pair = head_evaluate(cp->c_arg);
+	pos.p_cell = pair->c_left;
+	pos.p_off = 0;
+	auto n = scan(&pos, NO_CHAR);
+	chk_heap(NOCELL, StrCells(n) + 3);
+	newline = '\n';
+	auto rest = new_string(&newline, 1,
+			new_susp(e_unlines, new_pair(pair->c_right, NOCELL)));
+	pos.p_cell = pair->c_left;
+	pos.p_off = 0;
+	Pop_void();
+	return copy_chars(&pos, n, rest);
+}
+
+/*
+ *	words(text): spaces are skipped, and the next word, if any, is
+ *	evaluated and copied, up to the next space.
+ */
+Cell *
+text_words(Cell *text)
+{
+	Pos	pos;
+	Cell	*rest;
+
+	chk_stack(1);
+	Push(text);
+	pos.p_cell = text;
+	pos.p_off = 0;
+	while (more(&pos) && delimits(peek_char(&pos), ANY_SPACE))
+		pass_char(&pos);
+	if (! at_char(&pos)) {
+		Pop_void();
+		return new_cnst(nil);
+	}
+	auto start = pos;
+	auto n = scan(&pos, ANY_SPACE);
+	chk_heap(NOCELL, StrCells(n) + 6);
+	if (at_char(&pos)) {
+		pass_char(&pos);
+		rest = new_susp(e_words, new_pair(rest_list(&pos), NOCELL));
+	} else
+		rest = new_cnst(nil);
+	Pop_void();
+	return new_cons(cons,
+		new_pair(copy_chars(&start, n, new_cnst(nil)), rest));
+}
+
+/*
+ *	split(c, text): as lines, except that there is always a last part,
+ *	after the last c (or the whole text, if there is no c).
+ */
+Cell *
+text_split(Cell *arg)
+{
+	Pos	pos;
+	Cell	*rest;
+
+	chk_stack(1);
+	Push(arg);
+	auto c = head_evaluate(arg->c_left)->c_char;
+	pos.p_cell = arg->c_right;
+	pos.p_off = 0;
+	auto n = scan(&pos, c);
+	chk_heap(NOCELL, StrCells(n) + 7);
+	if (at_char(&pos)) {
+		pass_char(&pos);
+		rest = new_susp(e_split,
+			new_pair(new_pair(follow(arg->c_left), rest_list(&pos)),
+				 NOCELL));
+	} else
+		rest = new_cnst(nil);
+	pos.p_cell = arg->c_right;
+	pos.p_off = 0;
+	Pop_void();
+	return new_cons(cons,
+		new_pair(copy_chars(&pos, n, new_cnst(nil)), rest));
+}
+
+/*
+ *	join(c, w::ws): w is evaluated and copied, and the rest is
+ *	join(c, []::ws), which is [] if ws is, and c::join(c, ws) if not.
+ *	That is done here, so that empty parts need no more calls.
+ */
+Cell *
+text_join(Cell *arg)
+{
+	Pos	pos;
+	Bool	lead;	/* c comes first */
+
+	chk_stack(1);
+	Push(arg);
+	auto c = head_evaluate(arg->c_left)->c_char;
+	lead = FALSE;
+	for (auto ws = head_evaluate(arg->c_right); ; ) {
+		if (ws->c_class != C_CONS) {
+			Pop_void();
+			return new_cnst(nil);
+		}
+		auto pair = head_evaluate(ws->c_arg);
+		pos.p_cell = pair->c_left;
+		pos.p_off = 0;
+		auto n = scan(&pos, NO_CHAR);
+		if (n == 0 && ! lead) {
+			ws = head_evaluate(pair->c_right);
+			lead = TRUE;
+			continue;
+		}
+		chk_heap(NOCELL, StrCells(n) + 7);
+		auto rest = new_susp(e_join,
+			new_pair(new_pair(follow(arg->c_left),
+				new_cons(cons,
+					new_pair(new_cnst(nil),
+						 pair->c_right))),
+				 NOCELL));
+		pos.p_cell = pair->c_left;
+		pos.p_off = 0;
+		auto result = copy_chars(&pos, n, rest);
+		if (lead) {
+			SChar	sc = (SChar)c;
+			result = new_string(&sc, 1, result);
+		}
+		Pop_void();
+		return result;
+	}
+}
+
+/*
+ *	text_search(i, p, text): if p occurs in text, i plus the position
+ *	of the first occurrence, and the rest is another call from the
+ *	next position.  The text is scanned for the first character of p,
+ *	and the rest of p is compared only where it is found.  Only the
+ *	current cell of the text is kept on the stack, so the text passed
+ *	can be collected.
+ */
+Cell *
+text_search(Cell *arg)
+{
+	Pos	pos;
+	Char	first;
+
+	chk_stack(2);
+	Push(arg);
+	auto i = head_evaluate(arg->c_left)->c_num;
+	auto args = head_evaluate(arg->c_right);
+	pos.p_cell = args->c_left;
+	pos.p_off = 0;
+	auto m = scan(&pos, NO_CHAR);	/* evaluate p completely */
+	pos.p_cell = args->c_left;
+	pos.p_off = 0;
+	first = at_char(&pos) ? peek_char(&pos) : NO_CHAR;
+	Push(args->c_right);	/* the current cell of the text */
+	pos.p_cell = args->c_right;
+	pos.p_off = 0;
+	for (;;) {
+		if (! more(&pos)) {
+			if (m == 0)	/* found at the end */
+				break;
+			Pop_void();
+			Pop_void();
+			return new_cnst(nil);
+		}
+		auto cp = Top() = pos.p_cell;
+		if (m == 0)
+			break;
+		if (cp->c_class == C_STRING) {
+			/* a run of characters at once */
+			auto s = StrChars(cp);
+			auto j = pos.p_off;
+			while (j < cp->c_nchars && s[j] != first)
+				j++;
+			i += j - pos.p_off;
+			pos.p_off = j;
+			if (j == cp->c_nchars)
+				continue;
+		} else if (peek_char(&pos) != first) {
+			pass_char(&pos);
+			i++;
+			continue;
+		}
+		if (matches(pos, args->c_left))
+			break;
+		pass_char(&pos);
+		i++;
+	}
+	chk_heap(NOCELL, 10);
+	Cell	*rest;
+	if (at_char(&pos)) {
+		pass_char(&pos);
+		rest = new_susp(e_search,
+			new_pair(new_pair(new_num(i + 1),
+				new_pair(args->c_left, rest_list(&pos))),
+				 NOCELL));
+	} else
+		rest = new_cnst(nil);
+	Pop_void();
+	Pop_void();
+	return new_cons(cons, new_pair(new_num(i), rest));
+}
+
+/*
+ *	Positions.
+ */
+
+/*
+ *	Evaluate the list at *pp as far as the next character, if any,
+ *	returning FALSE at the end.
+ */
+static Bool
+more(Pos *pp)
+{
+	for (;;) {
+		auto cp = pp->p_cell = head_evaluate(follow(pp->p_cell));
+		if (cp->c_class == C_STRING) {
+			if (pp->p_off < cp->c_nchars)
+				return TRUE;
+			pp->p_cell = cp->c_rest;
+			pp->p_off = 0;
+		} else if (cp->c_class == C_CONS) {
+			(void)head_evaluate(head_evaluate(cp->c_arg)->c_left);
+			return TRUE;
+		} else
+			return FALSE;
+	}
+}
+
+/* the same, where the list has been evaluated (so no cells are used) */
+static Bool
+at_char(Pos *pp)
+{
+	for (;;) {
+		auto cp = pp->p_cell = follow(pp->p_cell);
+		if (cp->c_class != C_STRING)
+			return cp->c_class == C_CONS;
+		if (pp->p_off < cp->c_nchars)
+			return TRUE;
+		pp->p_cell = cp->c_rest;
+		pp->p_off = 0;
+	}
+}
+
+/* the next character, after more() or at_char() */
+static Char
+peek_char(const Pos *pp)
+{
+	auto cp = pp->p_cell;
+	if (cp->c_class == C_STRING)
+		return StrChars(cp)[pp->p_off];
+	return follow(follow(cp->c_arg)->c_left)->c_char;
+}
+
+static void
+pass_char(Pos *pp)
+{
+	auto cp = pp->p_cell;
+	if (cp->c_class == C_STRING)
+		pp->p_off++;
+	else
+		pp->p_cell = follow(cp->c_arg)->c_right;
+}
+
+/* the list from a position (taking at most one cell) */
+static Cell *
+rest_list(const Pos *pp)
+{
+	auto cp = follow(pp->p_cell);
+	if (cp->c_class != C_STRING || pp->p_off == 0)
+		return pp->p_cell;
+	if (pp->p_off == cp->c_nchars)
+		return cp->c_rest;
+	return new_string(StrChars(cp) + pp->p_off, cp->c_nchars - pp->p_off,
+			cp->c_rest);
+}
+
+static Bool
+delimits(Char c, Char delim)
+{
+	if (delim == ANY_SPACE)	/* as isspace in ctype.hop */
+		return c == ' ' || c == '\t' || c == '\n';
+	return c == delim;
+}
+
+/*
+ *	Evaluate the list at *pp up to the first character delimited by
+ *	delim, or the end, returning the number of characters before it.
+ *	*pp is left at the delimiter, if any.
+ */
+static long
+scan(Pos *pp, Char delim)
+{
+	long	n;
+
+	n = 0;
+	while (more(pp)) {
+		auto cp = pp->p_cell;
+		if (cp->c_class == C_STRING) {
+			/* a run of characters at once */
+			auto s = StrChars(cp);
+			auto i = pp->p_off;
+			while (i < cp->c_nchars && ! delimits(s[i], delim))
+				i++;
+			n += i - pp->p_off;
+			pp->p_off = i;
+			if (i < cp->c_nchars)
+				return n;
+		} else if (delimits(peek_char(pp), delim))
+			return n;
+		else {
+			pass_char(pp);
+			n++;
+		}
+	}
+	return n;
+}
+
+/*
+ *	Whether the list from pos, which has been evaluated, begins with
+ *	the characters of pattern, which has been evaluated completely.
+ *	More of the list is evaluated as it is needed.
+ */
+static Bool
+matches(Pos pos, Cell *pattern)
+{
+	Pos	pat;
+
+	pat.p_cell = pattern;
+	pat.p_off = 0;
+	while (at_char(&pat)) {
+		if (! more(&pos) || peek_char(&pos) != peek_char(&pat))
+			return FALSE;
+		pass_char(&pos);
+		pass_char(&pat);
+	}
+	return TRUE;
+}
+
+/*
+ *	Copy n characters of the list at *pp, which have been evaluated,
+ *	to packed strings, followed by rest.
+ *	This takes StrCells(n) free cells.
+ */
+static Cell *
+copy_chars(Pos *pp, long n, Cell *rest)
+{
+	SChar	chunk[STR_CHUNK];
+	Cell	*first;
+	int	k;
+
+	auto link = &first;
+	for ( ; n > 0; n -= k) {
+		k = n < (long)STR_CHUNK ? (int)n : STR_CHUNK;
+		for (int i = 0; i < k; i++) {
+			(void)at_char(pp);
+			chunk[i] = (SChar)peek_char(pp);
+			pass_char(pp);
+		}
+		auto cp = new_string(chunk, k, NOCELL);
+		*link = cp;
+		link = &cp->c_rest;
+	}
+	*link = rest;
+	return first;
+}
@@ -0,0 +1,21 @@
+#ifndef TEXT_FNS_H
+#define TEXT_FNS_H
+
+/*
+ *	Native functions on text, i.e. lists of characters.
+ */
+
+#include "defs.h"
+
+/* Call after reading standard module. */
+extern	void	init_text(void);
+
+/* the built-in functions */
+extern	Cell	*text_lines(Cell *text);
+extern	Cell	*text_unlines(Cell *lines);
+extern	Cell	*text_words(Cell *text);
+extern	Cell	*text_split(Cell *arg);
+extern	Cell	*text_join(Cell *arg);
+extern	Cell	*text_search(Cell *arg);
+
+#endif
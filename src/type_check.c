@@ -150,6 +150,8 @@ ty_expr(Expr *expr)
 		if ((dt = get_functor(expr)) != nullptr)
 			return functor_type(dt);
 		return ty_pattern(expr->e_patt, expr->e_level);
+	case expr_type::E_BANG:
+		return ty_expr(expr->e_rest);
 	case expr_type::E_PLUS:
 		type1 = new_const_type(num);
 		type2 = ty_expr(expr->e_rest);
@@ -379,6 +381,7 @@ get_functor(Expr *expr)
     case expr_type::E_RETURN:
     case expr_type::E_NCLASSES:
     case expr_type::E_PLUS:
+    case expr_type::E_BANG:
     case expr_type::E_VAR:
     case expr_type::E_IF:
     case expr_type::E_MU:
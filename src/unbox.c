@@ -0,0 +1,302 @@
+#include "defs.h"
+#include "unbox.h"
+#include "expr.h"
+#include "cases.h"
+#include "compile.h"
+#include "number.h"
+#include "usage.h"
+#include "strict.h"
+#include "path.h"
+#include "memory.h"
+
+/*
+ *	Unboxed calling convention.
+ *
+ *	Most functions take a single tuple argument, and most calls build
+ *	that tuple on the spot, only for the function to take it apart
+ *	again through DIRS steps (cf interpret.c).  If every equation of a
+ *	function of one argument matches a tuple pattern, the pairs common
+ *	to those patterns form its shape, and a worker is built: a lambda
+ *	with the same equations, taking the components at the leaves of
+ *	the shape as separate arguments, with bodies that fetch them
+ *	directly.  A call whose argument is a tuple expression covering
+ *	the shape is marked (cf strict.c), and the interpreter builds the
+ *	environment of the worker from the components, without the pairs.
+ *	Other calls use the original code, which serves as the wrapper.
+ *
+ *	The shape goes no deeper than strictness analysis, so that each
+ *	component the function is strict in can still be evaluated before
+ *	the call.  If no equation matches, the worker rebuilds the tuple
+ *	and passes it to the original code, to report the failure.
+ */
+
+#define	UB_DEPTH	STRICT_DEPTH	/* max. depth of a shape */
+
+static Expr	*shape(Expr *pattern, int depth);
+static Expr	*common(Expr *shape, Expr *pattern);
+static int	leaves(Expr *shape);
+static Bool	covers(Expr *arg, Expr *shape);
+static Expr	*parts(Expr *shape, Expr *pattern, Expr *formals);
+static Branch	*unpack_eqns(Branch *branch);
+static Expr	*unpack(Expr *expr, int local);
+static Branch	*unpack_branches(Branch *branch, int local);
+static Expr	*part(Expr *expr, int local);
+static Expr	*rebuild(Expr *shape, int *level);
+static Expr	*copy_node(Expr *expr);
+
+static	Expr	*cur_shape;	/* of the function being unboxed */
+static	int	cur_leaves;	/* number of leaves of cur_shape */
+static	Bool	whole;		/* a tuple of cur_shape is used whole */
+
+void
+unbox(Func *fn)
+{
+	Expr	*sh;
+	Branch	*br;
+	int	level;
+
+	fn->f_worker = nullptr;
+	fn->f_shape = nullptr;
+	if (fn->f_arity != 1)
+		return;
+	sh = shape(fn->f_branch->br_formals->e_arg, UB_DEPTH);
+	for (br = fn->f_branch->br_next; br != nullptr; br = br->br_next)
+		sh = common(sh, br->br_formals->e_arg);
+	if (sh == nullptr)	/* not a tuple */
+		return;
+
+	cur_shape = sh;
+	cur_leaves = leaves(sh);
+	whole = FALSE;
+	auto branches = unpack_eqns(fn->f_branch);
+	if (whole)
+		return;
+
+	auto worker = func_expr(branches);
+	(void)fv_expr(worker);
+	auto head = NEW(Expr);
+	head->e_class = expr_type::E_DEFUN;
+	head->e_used = ENV_ALL;
+	head->e_defun = fn;
+	level = cur_leaves;
+	/* less specific than any equation */
+	worker->e_code = success(apply_expr(head, rebuild(sh, &level)), -1);
+	for (br = branches; br != nullptr; br = br->br_next) {
+		br->br_body = us_expr(br->br_body, cur_leaves);
+		worker->e_code = comp_branch(worker->e_code, br);
+	}
+	fn->f_worker = worker;
+	fn->f_shape = sh;
+}
+
+/*
+ *	A call of fn with arg may pass the parts of arg to its worker, if
+ *	arg is built as a tuple covering the shape.
+ */
+Bool
+ub_call(Func *fn, Expr *arg)
+{
+	return fn->f_worker != nullptr && covers(arg, fn->f_shape);
+}
+
+static Bool
+covers(Expr *arg, Expr *shape)
+{
+	return shape == nullptr ||
+		(arg->e_class == expr_type::E_PAIR &&
+		 covers(arg->e_left, shape->e_left) &&
+		 covers(arg->e_right, shape->e_right));
+}
+
+/*
+ *	Shapes: trees of pairs, with null leaves.
+ */
+
+static Expr *
+shape(Expr *pattern, int depth)
+{
+	if (depth == 0 || pattern->e_class != expr_type::E_PAIR)
+		return nullptr;
+	return pair_expr(shape(pattern->e_left, depth-1),
+			shape(pattern->e_right, depth-1));
+}
+
+/* the part of shape that pattern also has */
+static Expr *
+common(Expr *shape, Expr *pattern)
+{
+	if (shape == nullptr || pattern->e_class != expr_type::E_PAIR)
+		return nullptr;
+	return pair_expr(common(shape->e_left, pattern->e_left),
+			common(shape->e_right, pattern->e_right));
+}
+
+static int
+leaves(Expr *shape)
+{
+	return shape == nullptr ? 1 :
+		leaves(shape->e_left) + leaves(shape->e_right);
+}
+
+/*
+ *	Add the parts of pattern at the leaves of shape to formals,
+ *	from left to right, so that the last is the innermost.
+ */
+static Expr *
+parts(Expr *shape, Expr *pattern, Expr *formals)
+{
+	if (shape == nullptr)
+		return apply_expr(formals, pattern);
+	return parts(shape->e_right, pattern->e_right,
+			parts(shape->e_left, pattern->e_left, formals));
+}
+
+/*
+ *	The equations of the worker: the argument is replaced by its
+ *	parts, so variables below it in the body are shifted out.
+ */
+static Branch *
+unpack_eqns(Branch *branch)
+{
+	if (branch == nullptr)
+		return nullptr;
+	auto copy = new_branch(parts(cur_shape, branch->br_formals->e_arg,
+					(Expr *)0),
+			unpack(branch->br_body, 0),
+			unpack_eqns(branch->br_next));
+	if (branch->br_expr != branch->br_body)
+		copy->br_expr = unpack(branch->br_expr, 0);
+	return copy;
+}
+
+/*
+ *	A copy of expr, nested within local scopes of the body, with the
+ *	argument at level local replaced by its parts.
+ */
+static Expr *
+unpack(Expr *expr, int local)
+{
+	Expr	*copy;
+
+	switch (expr->e_class) {
+	case expr_type::E_PARAM:
+		if (expr->e_level < local)
+			return expr;
+		if (expr->e_level == local)
+			return part(expr, local);
+		copy = copy_node(expr);
+		copy->e_level += cur_leaves - 1;
+		return copy;
+	case expr_type::E_PAIR:
+		return pair_expr(unpack(expr->e_left, local),
+				unpack(expr->e_right, local));
+	case expr_type::E_APPLY:
+	case expr_type::E_IF:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+		copy = copy_node(expr);
+		copy->e_func = unpack(expr->e_func, local);
+		copy->e_arg = unpack(expr->e_arg, local);
+		return copy;
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+		copy = copy_node(expr);
+		copy->e_func = copy_node(expr->e_func);
+		copy->e_func->e_branch = unpack_branches(
+					expr->e_func->e_branch, local+1);
+		copy->e_arg = unpack(expr->e_arg, local+1);
+		return copy;
+	case expr_type::E_MU:
+		copy = copy_node(expr);
+		copy->e_body = unpack(expr->e_body, local+1);
+		return copy;
+	case expr_type::E_LAMBDA:
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		copy = copy_node(expr);
+		copy->e_branch = unpack_branches(expr->e_branch,
+					local + expr->e_arity);
+		return copy;
+	case expr_type::E_NUM:
+	case expr_type::E_CHAR:
+	case expr_type::E_CONS:
+	case expr_type::E_DEFUN:
+		return expr;
+	case expr_type::E_VAR:
+	case expr_type::E_PLUS:
+	case expr_type::E_BANG:
+	case expr_type::E_BUILTIN:
+	case expr_type::E_BU_1MATH:
+	case expr_type::E_BU_2MATH:
+	case expr_type::E_RETURN:
+	case expr_type::E_NCLASSES:
+		NOT_REACHED;
+	}
+}
+
+static Branch *
+unpack_branches(Branch *branch, int local)
+{
+	if (branch == nullptr)
+		return nullptr;
+	auto copy = new_branch(branch->br_formals,
+			unpack(branch->br_body, local),
+			unpack_branches(branch->br_next, local));
+	if (branch->br_expr != branch->br_body)
+		copy->br_expr = unpack(branch->br_expr, local);
+	return copy;
+}
+
+/*
+ *	A use of the argument: follow its path down the shape to the part
+ *	it lies in, and fetch the rest of the way from there.  Only the
+ *	steps into pairs not yet evaluated are preceded by UNROLL
+ *	(cf p_reverse()).
+ */
+static Expr *
+part(Expr *expr, int local)
+{
+	auto path = expr->e_where;
+	auto sh = cur_shape;
+	int	n = 0;		/* leaves to the left */
+	while (sh != nullptr) {
+		if (p_top(path) == P_UNROLL)
+			path = p_pop(path);
+		if (p_top(path) == P_LEFT)
+			sh = sh->e_left;
+		else if (p_top(path) == P_RIGHT) {
+			n += leaves(sh->e_left);
+			sh = sh->e_right;
+		} else {
+			whole = TRUE;
+			return expr;
+		}
+		path = p_pop(path);
+	}
+	auto copy = copy_node(expr);
+	copy->e_level = local + cur_leaves-1 - n;
+	copy->e_where = path;
+	return copy;
+}
+
+/* the tuple of parameters of the worker, numbered down from *level */
+static Expr *
+rebuild(Expr *shape, int *level)
+{
+	if (shape == nullptr) {
+		auto param = dir_expr(p_new());
+		param->e_level = --*level;
+		return param;
+	}
+	auto left = rebuild(shape->e_left, level);
+	return pair_expr(left, rebuild(shape->e_right, level));
+}
+
+static Expr *
+copy_node(Expr *expr)
+{
+	auto copy = NEW(Expr);
+	*copy = *expr;
+	return copy;
+}
@@ -0,0 +1,16 @@
+#ifndef UNBOX_H
+#define UNBOX_H
+
+#include "defs.h"
+
+/*
+ *	Unboxed calls (cf unbox.c).
+ */
+
+/* (Re)build the worker of fn, which has just been given an equation. */
+extern	void	unbox(Func *fn);
+
+/* A call of fn with arg may pass the parts of arg to its worker. */
+extern	Bool	ub_call(Func *fn, Expr *arg);
+
+#endif
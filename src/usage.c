@@ -0,0 +1,219 @@
+#include "defs.h"
+#include "usage.h"
+#include "expr.h"
+#include "path.h"
+#include "memory.h"
+#include "number.h"
+
+/*
+ *	Usage analysis.
+ *
+ *	Normally a variable is entered with an update frame, so that its
+ *	cell is overwritten with its value and the work is not repeated
+ *	(cf interpret.c).  If the cell bound to a whole argument or let
+ *	variable is certainly entered at most once, the update is wasted:
+ *	the occurrence that enters it is marked (e_once), and the
+ *	interpreter enters the cell directly.
+ *
+ *	A cell is bound to a single variable (arguments are suspended
+ *	afresh, cf suspend()), if it is the last argument of a call or a
+ *	let variable (earlier arguments are shared by all the calls of a
+ *	partial application), so it suffices that the variable occurs
+ *	at most once in each evaluation of its scope: a single occurrence,
+ *	counting only the limb of a conditional that is taken, not inside
+ *	a lambda (which may be called many times), and not part of a
+ *	pattern (whose components are shared with the whole value).
+ *	A suspension containing the occurrence is itself evaluated once.
+ *	Variables of recursive definitions are not considered.
+ *
+ *	Parts of bodies may be shared between definitions (cf simplify.c),
+ *	so an occurrence is only ever marked in a copy of its own, while
+ *	a mark may be cleared in place.
+ */
+
+static Natural	uses(Expr *expr, Natural *many);
+static Natural	br_uses(Branch *branch, int arity, Natural *many);
+static Expr	*mark(Expr *expr, int level);
+static void	mark_branches(Branch *branch, int level);
+
+Expr *
+us_expr(Expr *expr, int arity)
+{
+	Natural	many;
+
+	many = 0;
+	auto vars = uses(expr, &many);
+	if (arity > 0 && (vars & ~many & EnvBit(0)) != 0)
+		expr = mark(expr, 0);
+	return expr;
+}
+
+/*
+ *	The variables (as in e_used) that may be entered in an evaluation
+ *	of expr, adding to *many those that may be entered more than once.
+ *	This is a single pass, from the bottom up: on the way, the marks
+ *	in expr are cleared, and the occurrence of the last formal of each
+ *	branch within it that is entered just once is marked.
+ */
+static Natural
+uses(Expr *expr, Natural *many)
+{
+	Natural	vars, limbs, m;
+
+	switch (expr->e_class) {
+	case expr_type::E_PARAM:
+		expr->e_once = FALSE;
+		vars = EnvBit(expr->e_level);
+		if (! p_empty(expr->e_where))
+			*many |= vars;
+		return vars;
+	case expr_type::E_IF:
+		/* the condition, and one of the limbs */
+		vars = uses(expr->e_func->e_func->e_arg, many);
+		limbs = uses(expr->e_func->e_arg, many) |
+			uses(expr->e_arg, many);
+		*many |= vars & limbs;
+		return vars | limbs;
+	case expr_type::E_PAIR:
+	case expr_type::E_APPLY:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+		vars = uses(expr->e_left, many);
+		m = uses(expr->e_right, many);
+		*many |= vars & m;
+		return vars | m;
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+		m = 0;
+		vars = br_uses(expr->e_func->e_branch, 0, &m);
+		limbs = uses(expr->e_arg, &m);
+		*many |= fv_shift(m | (vars & limbs), 1);
+		return fv_shift(vars | limbs, 1);
+	case expr_type::E_MU:
+		m = 0;
+		vars = fv_shift(uses(expr->e_body, &m), 1);
+		*many |= vars;
+		return vars;
+	case expr_type::E_EQN:	/* applied once */
+		return br_uses(expr->e_branch, expr->e_arity, many);
+	case expr_type::E_LAMBDA:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		/*
+		 * Any variable it uses, including in the originals, as
+		 * printing enters them (cf fv_expr()), may be entered by
+		 * many calls.
+		 */
+		m = 0;
+		(void)br_uses(expr->e_branch, expr->e_arity, &m);
+		*many |= expr->e_used;
+		return expr->e_used;
+	case expr_type::E_NUM:
+	case expr_type::E_CHAR:
+	case expr_type::E_CONS:
+	case expr_type::E_DEFUN:
+		return 0;
+	case expr_type::E_VAR:
+	case expr_type::E_PLUS:
+	case expr_type::E_BANG:
+	case expr_type::E_BUILTIN:
+	case expr_type::E_BU_1MATH:
+	case expr_type::E_BU_2MATH:
+	case expr_type::E_RETURN:
+	case expr_type::E_NCLASSES:
+		NOT_REACHED;
+	}
+}
+
+/*
+ *	The uses in the bodies of branches, with arity formals, which are
+ *	all entered in an evaluation (cf E_EQN above).  The last formal of
+ *	a branch is marked if it is entered just once: the others may be
+ *	shared by many calls of a partial application.
+ */
+static Natural
+br_uses(Branch *branch, int arity, Natural *many)
+{
+	Natural	vars, m;
+
+	vars = m = 0;
+	for ( ; branch != nullptr; branch = branch->br_next) {
+		Natural	br_many;
+
+		br_many = 0;
+		auto br_vars = uses(branch->br_body, &br_many);
+		if (arity > 0 && (br_vars & ~br_many & EnvBit(0)) != 0)
+			branch->br_body = mark(branch->br_body, 0);
+		m |= br_many | (vars & br_vars);
+		vars |= br_vars;
+	}
+	*many |= fv_shift(m, arity);
+	return fv_shift(vars, arity);
+}
+
+/*
+ *	Mark the occurrence in expr of the variable at level, which is
+ *	entered just once, returning the marked expression.  Only the parts
+ *	that use it (cf e_used) are visited.
+ */
+static Expr *
+mark(Expr *expr, int level)
+{
+	Expr	*copy;
+
+	if ((expr->e_used & EnvBit(level)) == 0)
+		return expr;
+	switch (expr->e_class) {
+	case expr_type::E_PARAM:
+		if (expr->e_level != level)
+			return expr;
+		copy = NEW(Expr);
+		*copy = *expr;
+		copy->e_once = TRUE;
+		return copy;
+	case expr_type::E_PAIR:
+	case expr_type::E_APPLY:
+	case expr_type::E_IF:
+	case expr_type::E_LET:
+	case expr_type::E_WHERE:
+		expr->e_left = mark(expr->e_left, level);
+		expr->e_right = mark(expr->e_right, level);
+		return expr;
+	case expr_type::E_RLET:
+	case expr_type::E_RWHERE:
+		mark_branches(expr->e_func->e_branch, level+1);
+		expr->e_arg = mark(expr->e_arg, level+1);
+		return expr;
+	case expr_type::E_MU:
+		expr->e_body = mark(expr->e_body, level+1);
+		return expr;
+	case expr_type::E_LAMBDA:
+	case expr_type::E_EQN:
+	case expr_type::E_PRESECT:
+	case expr_type::E_POSTSECT:
+		mark_branches(expr->e_branch, level + expr->e_arity);
+		return expr;
+	case expr_type::E_NUM:
+	case expr_type::E_CHAR:
+	case expr_type::E_CONS:
+	case expr_type::E_DEFUN:
+		return expr;
+	case expr_type::E_VAR:
+	case expr_type::E_PLUS:
+	case expr_type::E_BANG:
+	case expr_type::E_BUILTIN:
+	case expr_type::E_BU_1MATH:
+	case expr_type::E_BU_2MATH:
+	case expr_type::E_RETURN:
+	case expr_type::E_NCLASSES:
+		NOT_REACHED;
+	}
+}
+
+/* only the bodies are run: the originals are left alone */
+static void
+mark_branches(Branch *branch, int level)
+{
+	for ( ; branch != nullptr; branch = branch->br_next)
+		branch->br_body = mark(branch->br_body, level);
+}
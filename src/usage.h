@@ -0,0 +1,15 @@
+#ifndef USAGE_H
+#define USAGE_H
+
+#include "defs.h"
+
+/*
+ *	Usage analysis (cf usage.c): mark the occurrences of variables in
+ *	expr, the body of a definition with arity formals (or a top level
+ *	expression, with none), that are the only entry to their cells,
+ *	so that they can be entered without an update.
+ *	Returns the marked body, which may be a copy.
+ */
+extern	Expr	*us_expr(Expr *expr, int arity);
+
+#endif
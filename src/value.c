@@ -1,5 +1,6 @@
 #include "defs.h"
 #include "value.h"
+#include "cons.h"
 
 Cell *
 new_pair(Cell *left, Cell *right)
@@ -96,3 +97,28 @@ new_stream(FILE *f)
 	cp->c_file = f;
 	return cp;
 }
+
+Cell *
+new_string(const SChar *s, int n, Cell *rest)
+{
+	auto cp = new_cell(C_STRING);
+	cp->c_nchars = n;
+	(void)memcpy(StrChars(cp), s, n*sizeof(SChar));
+	cp->c_rest = rest;
+	return cp;
+}
+
+Cell *
+unpack_string(Cell *cell)
+{
+	Cell	*rest;
+
+	if (cell->c_nchars == 1)
+		rest = cell->c_rest;
+	else {
+		rest = new_cell(C_STRING);
+		*rest = *cell;
+		rest->c_nchars--;
+	}
+	return new_cons(cons, new_pair(new_char(*StrChars(cell)), rest));
+}
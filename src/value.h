@@ -13,12 +13,16 @@
 #define	C_CONST		CellClass(0, 2)	/* constant */
 #define	C_STREAM	CellClass(0, 3)	/* partially read input stream */
 #define	C_HOLE		CellClass(0, 4)	/* black hole */
+#define	C_ARRAY		CellClass(0, 5)	/* slice of an array (cf array.h) */
+#define	C_VECTOR	CellClass(0, 6)	/* slice of a vector (cf vector.h) */
 #define	C_CONS		CellClass(1, 0)	/* constructed term */
 #define	C_SUSP		CellClass(1, 1)	/* term and environment */
 #define C_DIRS		CellClass(1, 2)	/* directions and value */
 #define C_UCASE		CellClass(1, 3)	/* upper case */
 #define C_LCASE		CellClass(1, 4)	/* lower case */
 #define C_PAPP		CellClass(1, 5)	/* partial application */
+#define C_IND		CellClass(1, 6)	/* indirection (cf interpret.c) */
+#define C_STRING	CellClass(1, 7)	/* packed characters, then a list */
 #define	C_PAIR		CellClass(2, 0)	/* pair and list builder */
 
 /* fields for data cells */
@@ -34,6 +38,13 @@
 #define	c_env	c_union.cu_one.cu_cell		/* SUSP, UCASE, LCASE, PAPP */
 #define	c_path	c_union.cu_one.co_union.cu_path	/* DIRS */
 #define	c_val	c_union.cu_one.cu_cell		/* DIRS */
+#define	c_ind	c_union.cu_one.cu_cell		/* IND */
+#define	c_nchars c_misc_num			/* STRING */
+#define	c_chars	c_union.cu_one.co_union.cu_chars /* STRING */
+#define	c_rest	c_union.cu_one.cu_cell		/* STRING */
+#define	c_block	c_union.cu_arr.cu_block		/* ARRAY, VECTOR */
+#define	c_start	c_union.cu_arr.cu_start		/* ARRAY, VECTOR */
+#define	c_size	c_union.cu_arr.cu_size		/* ARRAY, VECTOR */
 #define	c_left	c_union.cu_two.cu_left		/* PAIR */
 #define	c_right	c_union.cu_two.cu_right		/* PAIR */
 
@@ -49,4 +60,19 @@ extern	Cell	*new_ucase(UCase *code, Cell *env);
 extern	Cell	*new_lcase(LCase *lcase, Cell *env);
 extern	Cell	*new_pair(Cell *left, Cell *right);
 
+/*
+ *	Packed strings.
+ *	A STRING cell holds up to STR_CHUNK characters of a list, kept at
+ *	the end of c_chars, followed by the rest of the list.  It stands
+ *	for the corresponding cons cells, which the interpreter builds
+ *	only if the list is matched (cf unpack_string()).  Code that walks
+ *	a forced list must expect either form.
+ */
+#define	StrChars(cp)	((cp)->c_chars + STR_CHUNK - (cp)->c_nchars)
+
+/* n characters (1 <= n <= STR_CHUNK) followed by the list rest */
+extern	Cell	*new_string(const SChar *s, int n, Cell *rest);
+/* the first character and the rest, as a cons cell (at most 4 new cells) */
+extern	Cell	*unpack_string(Cell *cell);
+
 #endif
@@ -0,0 +1,346 @@
+#include "defs.h"
+#include "vector.h"
+#include "array.h"
+#include "value.h"
+#include "cons.h"
+#include "expr.h"
+#include "path.h"
+#include "memory.h"
+#include "stack.h"
+#include "interpret.h"
+#include "error.h"
+
+/*
+ *	Vectors of numbers.
+ *	The elements are evaluated when the vector is built, and stored
+ *	as plain numbers, so the loops below work on contiguous memory
+ *	and can be vectorised by the compiler.
+ */
+
+/* the elements of a vector */
+#define	Elts(v)	((v)->c_block->a_num + (v)->c_start)
+
+#define	MAX_COPY	256	/* max. elements listed by one call of vector2list */
+
+static Expr	*e_listing;	/* vector2list applied to var 0 */
+
+static Cell	*new_vector(Array *block, int start, int size);
+static Cell	*new_zip(Cell *arg, const Num **xp, const Num **yp, Num **rp);
+static Cell	*new_map(Cell *arg, const Num **xp, Num **rp);
+static Num	sum(const Num *x, int n);
+static Num	dot(const Num *x, const Num *y, int n);
+
+void
+init_vector(void)
+{
+	auto fn = fn_lookup(newstring("vector2list"));
+	ASSERT( fn != nullptr );
+	auto fn_expr = NEW(Expr);
+	fn_expr->e_class = expr_type::E_DEFUN;
+	fn_expr->e_used = ENV_ALL;
+	fn_expr->e_defun = fn;
+	e_listing = apply_expr(fn_expr, dir_expr(p_new()));
+}
+
+/*
+ *	Convert a list of numbers, in head normal form, to a vector.
+ *	The list and its elements are evaluated first (the cells are
+ *	updated, so it all stays reachable from the list on the stack),
+ *	and the numbers are then copied into a block of the right size.
+ */
+Cell *
+list2vector(Cell *list)
+{
+	long	n;
+
+	chk_stack(1);
+	Push(list);
+	n = 0;
+	for (auto cp = list; cp->c_class == C_CONS; n++) {
+		auto pair = head_evaluate(cp->c_arg);
+		(void)head_evaluate(pair->c_left);
+		cp = head_evaluate(pair->c_right);
+	}
+	chk_heap(NOCELL, 1);
+	auto vector = new_vector(new_block(n, sizeof(Num)), 0, (int)n);
+	auto r = Elts(vector);
+	for (auto cp = follow(Pop()); cp->c_class == C_CONS;
+	     cp = follow(follow(cp->c_arg)->c_right))
+		*r++ = follow(follow(cp->c_arg)->c_left)->c_num;
+	return vector;
+}
+
+/*
+ *	Convert a vector to a list, up to MAX_COPY elements at a time:
+ *	the rest of the list is a suspension of vector2list on a slice
+ *	of the vector sharing its block.
+ */
+Cell *
+vector2list(Cell *arg)
+{
+	auto n = arg->c_size < MAX_COPY ? arg->c_size : MAX_COPY;
+	/* 3 cells for each element, and the rest */
+	chk_heap(arg, 3*n + 3);
+	auto x = Elts(arg);
+	Cell	*list;
+	if (n == arg->c_size)
+		list = new_cnst(nil);
+	else
+		list = new_susp(e_listing,
+			new_pair(new_vector(arg->c_block, arg->c_start + n,
+					    arg->c_size - n),
+				 NOCELL));
+	for (int i = n; i-- > 0; )
+		list = new_cons(cons, new_pair(new_num(x[i]), list));
+	return list;
+}
+
+Cell *
+vector_length(Cell *arg)
+{
+	return new_num((Num)arg->c_size);
+}
+
+Cell *
+vector_sub(Cell *arg)
+{
+	auto vector = arg->c_left;
+	return new_num(Elts(vector)[array_index(arg->c_right,
+						vector->c_size, "vector")]);
+}
+
+/* the elements from i up to (but not including) j, sharing the block */
+Cell *
+vector_slice(Cell *arg)
+{
+	auto vector = arg->c_left;
+	auto i = array_index(arg->c_right->c_left, vector->c_size + 1,
+			     "vector");
+	auto j = array_index(arg->c_right->c_right, vector->c_size + 1,
+			     "vector");
+	if (j < i)
+		error(EXECERR, "vector index out of range");
+	return new_vector(vector->c_block, vector->c_start + i, j - i);
+}
+
+/*
+ *	Elementwise operations.
+ */
+
+Cell *
+vector_plus(Cell *arg)
+{
+	const	Num	*x, *y;
+	Num	*r;
+
+	auto result = new_zip(arg, &x, &y, &r);
+	auto n = result->c_size;
+	for (int i = 0; i < n; i++)
+		r[i] = x[i] + y[i];
+	return result;
+}
+
+Cell *
+vector_minus(Cell *arg)
+{
+	const	Num	*x, *y;
+	Num	*r;
+
+	auto result = new_zip(arg, &x, &y, &r);
+	auto n = result->c_size;
+	for (int i = 0; i < n; i++)
+		r[i] = x[i] - y[i];
+	return result;
+}
+
+Cell *
+vector_times(Cell *arg)
+{
+	const	Num	*x, *y;
+	Num	*r;
+
+	auto result = new_zip(arg, &x, &y, &r);
+	auto n = result->c_size;
+	for (int i = 0; i < n; i++)
+		r[i] = x[i] * y[i];
+	return result;
+}
+
+Cell *
+vector_scale(Cell *arg)
+{
+	const	Num	*x;
+	Num	*r;
+
+	auto k = arg->c_left->c_num;
+	auto result = new_map(arg, &x, &r);
+	auto n = result->c_size;
+	for (int i = 0; i < n; i++)
+		r[i] = k * x[i];
+	return result;
+}
+
+/* prefix sums: the ith element is the sum of the first i+1 */
+Cell *
+vector_scan(Cell *arg)
+{
+	const	Num	*x;
+	Num	*r;
+	Num	s;
+
+	auto result = new_map(arg, &x, &r);
+	auto n = result->c_size;
+	s = Zero;
+	for (int i = 0; i < n; i++)
+		r[i] = s += x[i];
+	return result;
+}
+
+/*
+ *	Reductions.
+ *	Sums are accumulated in several parts, which are independent and
+ *	can be added in parallel, so they may differ in the last place
+ *	from sums taken strictly from left to right.
+ */
+
+Cell *
+vector_sum(Cell *arg)
+{
+	return new_num(sum(Elts(arg), arg->c_size));
+}
+
+Cell *
+vector_dot(Cell *arg)
+{
+	auto x = arg->c_left;
+	auto y = arg->c_right;
+	if (x->c_size != y->c_size)
+		error(EXECERR, "vector lengths differ");
+	return new_num(dot(Elts(x), Elts(y), x->c_size));
+}
+
+Cell *
+vector_min(Cell *arg)
+{
+	auto x = Elts(arg);
+	auto n = arg->c_size;
+	if (n == 0)
+		error(EXECERR, "vector_min: empty vector");
+	auto m = x[0];
+	for (int i = 1; i < n; i++)
+		if (x[i] < m)
+			m = x[i];
+	return new_num(m);
+}
+
+Cell *
+vector_max(Cell *arg)
+{
+	auto x = Elts(arg);
+	auto n = arg->c_size;
+	if (n == 0)
+		error(EXECERR, "vector_max: empty vector");
+	auto m = x[0];
+	for (int i = 1; i < n; i++)
+		if (x[i] > m)
+			m = x[i];
+	return new_num(m);
+}
+
+static Num
+sum(const Num *x, int n)
+{
+	Num	s0, s1, s2, s3;
+	int	i;
+
+	s0 = s1 = s2 = s3 = Zero;
+	for (i = 0; i + 4 <= n; i += 4) {
+		s0 += x[i];
+		s1 += x[i+1];
+		s2 += x[i+2];
+		s3 += x[i+3];
+	}
+	for ( ; i < n; i++)
+		s0 += x[i];
+	return (s0 + s1) + (s2 + s3);
+}
+
+static Num
+dot(const Num *x, const Num *y, int n)
+{
+	Num	s0, s1, s2, s3;
+	int	i;
+
+	s0 = s1 = s2 = s3 = Zero;
+	for (i = 0; i + 4 <= n; i += 4) {
+		s0 += x[i]*y[i];
+		s1 += x[i+1]*y[i+1];
+		s2 += x[i+2]*y[i+2];
+		s3 += x[i+3]*y[i+3];
+	}
+	for ( ; i < n; i++)
+		s0 += x[i]*y[i];
+	return (s0 + s1) + (s2 + s3);
+}
+
+/*
+ *	Compare vectors element by element, a prefix coming first.
+ */
+int
+cmp_vectors(Cell *first, Cell *second)
+{
+	auto x = Elts(first);
+	auto y = Elts(second);
+	auto n = first->c_size < second->c_size ?
+			first->c_size : second->c_size;
+	for (int i = 0; i < n; i++)
+		if (x[i] != y[i])
+			return x[i] < y[i] ? -1 : 1;
+	return first->c_size - second->c_size;
+}
+
+/*
+ *	A new vector the length of the pair of vectors arg, which must be
+ *	the same, with pointers to the elements of all three.
+ */
+static Cell *
+new_zip(Cell *arg, const Num **xp, const Num **yp, Num **rp)
+{
+	auto x = arg->c_left;
+	auto y = arg->c_right;
+	if (x->c_size != y->c_size)
+		error(EXECERR, "vector lengths differ");
+	chk_heap(arg, 1);
+	auto result = new_vector(new_block(x->c_size, sizeof(Num)),
+				0, x->c_size);
+	*xp = Elts(x);
+	*yp = Elts(y);
+	*rp = Elts(result);
+	return result;
+}
+
+/*
+ *	A new vector the length of arg, or of the vector on the right of
+ *	it if it is a pair, with pointers to the elements of both.
+ */
+static Cell *
+new_map(Cell *arg, const Num **xp, Num **rp)
+{
+	auto x = arg->c_class == C_PAIR ? arg->c_right : arg;
+	chk_heap(arg, 1);
+	auto result = new_vector(new_block(x->c_size, sizeof(Num)),
+				0, x->c_size);
+	*xp = Elts(x);
+	*rp = Elts(result);
+	return result;
+}
+
+static Cell *
+new_vector(Array *block, int start, int size)
+{
+	auto cp = new_cell(C_VECTOR);
+	cp->c_block = block;
+	cp->c_start = start;
+	cp->c_size = size;
+	return cp;
+}
@@ -0,0 +1,32 @@
+#ifndef VECTOR_H
+#define VECTOR_H
+
+/*
+ *	Vectors: immutable sequences of numbers, stored unboxed in blocks
+ *	like those of arrays (cf array.h).
+ */
+
+#include "defs.h"
+
+extern	void	init_vector(void);
+
+/* the built-in functions */
+extern	Cell	*list2vector(Cell *list);
+extern	Cell	*vector2list(Cell *arg);
+extern	Cell	*vector_length(Cell *arg);
+extern	Cell	*vector_sub(Cell *arg);
+extern	Cell	*vector_slice(Cell *arg);
+extern	Cell	*vector_plus(Cell *arg);
+extern	Cell	*vector_minus(Cell *arg);
+extern	Cell	*vector_times(Cell *arg);
+extern	Cell	*vector_scale(Cell *arg);
+extern	Cell	*vector_dot(Cell *arg);
+extern	Cell	*vector_sum(Cell *arg);
+extern	Cell	*vector_min(Cell *arg);
+extern	Cell	*vector_max(Cell *arg);
+extern	Cell	*vector_scan(Cell *arg);
+
+/* compare two vectors, returning <0, 0 or >0 */
+extern	int	cmp_vectors(Cell *first, Cell *second);
+
+#endif
@@ -67,6 +67,7 @@ static Symbol	reserved[] = {
 	{ "pubconst",	PUBCONST },	/* for sideways compatability */
 	{ "pubfun",	PUBFUN	},	/* for sideways compatability */
 	{ "pubtype",	PUBTYPE	},	/* for sideways compatability */
+	{ "reset",	RESET	},
 	{ "save",	SAVE	},
 	{ "then",	THEN	},
 	{ "to",		TO	},
@@ -1,12 +1,14 @@
-/* A Bison parser, made by GNU Bison 1.875a.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* Skeleton parser for Yacc-like parsing with Bison,
-   Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003 Free Software Foundation, Inc.
+/* Bison implementation for Yacc-like parsers in C
 
-   This program is free software; you can redistribute it and/or modify
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
 
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
@@ -14,17 +16,27 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 59 Temple Place - Suite 330,
-   Boston, MA 02111-1307, USA.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
 
-/* As a special exception, when this file is copied by Bison into a
-   Bison output file, you may use that output file without restriction.
-   This special exception was added by the Free Software Foundation
-   in version 1.24 of Bison.  */
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
 
-/* Written by Richard Stallman by simplifying the original so called
-   ``semantic'' parser.  */
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
 
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
@@ -33,8 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -42,148 +57,16 @@
 /* Pure parsers.  */
 #define YYPURE 0
 
-/* Using locations.  */
-#define YYLSP_NEEDED 0
+/* Push parsers.  */
+#define YYPUSH 0
 
-
-
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     TYPEVAR = 258,
-     ABSTYPE = 259,
-     DATA = 260,
-     TYPESYM = 261,
-     DEC = 262,
-     INFIX = 263,
-     INFIXR = 264,
-     USES = 265,
-     PRIVATE = 266,
-     DISPLAY = 267,
-     SAVE = 268,
-     WRITE = 269,
-     TO = 270,
-     EXIT = 271,
-     EDIT = 272,
-     DEFEQ = 273,
-     OR = 274,
-     VALOF = 275,
-     IS = 276,
-     GIVES = 277,
-     THEN = 278,
-     FORALL = 279,
-     MODSYM = 280,
-     PUBCONST = 281,
-     PUBFUN = 282,
-     PUBTYPE = 283,
-     END = 284,
-     MU = 285,
-     IN = 286,
-     WHEREREC = 287,
-     WHERE = 288,
-     ELSE = 289,
-     BIN_BASE = 290,
-     LBINARY1 = 291,
-     RBINARY1 = 292,
-     LBINARY2 = 293,
-     RBINARY2 = 294,
-     LBINARY3 = 295,
-     RBINARY3 = 296,
-     LBINARY4 = 297,
-     RBINARY4 = 298,
-     LBINARY5 = 299,
-     RBINARY5 = 300,
-     LBINARY6 = 301,
-     RBINARY6 = 302,
-     LBINARY7 = 303,
-     RBINARY7 = 304,
-     LBINARY8 = 305,
-     RBINARY8 = 306,
-     LBINARY9 = 307,
-     RBINARY9 = 308,
-     NONOP = 309,
-     LAMBDA = 310,
-     IF = 311,
-     LETREC = 312,
-     LET = 313,
-     CHAR = 314,
-     LITERAL = 315,
-     NUMBER = 316,
-     IDENT = 317,
-     APPLY = 318,
-     ALWAYS_REDUCE = 319
-   };
-#endif
-#define TYPEVAR 258
-#define ABSTYPE 259
-#define DATA 260
-#define TYPESYM 261
-#define DEC 262
-#define INFIX 263
-#define INFIXR 264
-#define USES 265
-#define PRIVATE 266
-#define DISPLAY 267
-#define SAVE 268
-#define WRITE 269
-#define TO 270
-#define EXIT 271
-#define EDIT 272
-#define DEFEQ 273
-#define OR 274
-#define VALOF 275
-#define IS 276
-#define GIVES 277
-#define THEN 278
-#define FORALL 279
-#define MODSYM 280
-#define PUBCONST 281
-#define PUBFUN 282
-#define PUBTYPE 283
-#define END 284
-#define MU 285
-#define IN 286
-#define WHEREREC 287
-#define WHERE 288
-#define ELSE 289
-#define BIN_BASE 290
-#define LBINARY1 291
-#define RBINARY1 292
-#define LBINARY2 293
-#define RBINARY2 294
-#define LBINARY3 295
-#define RBINARY3 296
-#define LBINARY4 297
-#define RBINARY4 298
-#define LBINARY5 299
-#define RBINARY5 300
-#define LBINARY6 301
-#define RBINARY6 302
-#define LBINARY7 303
-#define RBINARY7 304
-#define LBINARY8 305
-#define RBINARY8 306
-#define LBINARY9 307
-#define RBINARY9 308
-#define NONOP 309
-#define LAMBDA 310
-#define IF 311
-#define LETREC 312
-#define LET 313
-#define CHAR 314
-#define LITERAL 315
-#define NUMBER 316
-#define IDENT 317
-#define APPLY 318
-#define ALWAYS_REDUCE 319
+/* Pull parsers.  */
+#define YYPULL 1
 
 
 
 
-/* Copy the first part of user declarations.  */
+/* First part of user prologue.  */
 
 #include "defs.h"
 #include "memory.h"
@@ -195,25 +78,193 @@
 #include "deftype.h"
 #include "cons.h"
 #include "eval.h"
+#include "heap.h"
 #include "error.h"
 #include "text.h"
 
 
-/* Enabling traces.  */
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+/* Use api.header.include to #include this header
+   instead of duplicating it here.  */
+#ifndef YY_YY_Y_TAB_H_INCLUDED
+# define YY_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
 #ifndef YYDEBUG
 # define YYDEBUG 0
 #endif
+#if YYDEBUG
+extern int yydebug;
+#endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    TYPEVAR = 258,                 /* TYPEVAR  */
+    ABSTYPE = 259,                 /* ABSTYPE  */
+    DATA = 260,                    /* DATA  */
+    TYPESYM = 261,                 /* TYPESYM  */
+    DEC = 262,                     /* DEC  */
+    INFIX = 263,                   /* INFIX  */
+    INFIXR = 264,                  /* INFIXR  */
+    USES = 265,                    /* USES  */
+    PRIVATE = 266,                 /* PRIVATE  */
+    DISPLAY = 267,                 /* DISPLAY  */
+    SAVE = 268,                    /* SAVE  */
+    WRITE = 269,                   /* WRITE  */
+    TO = 270,                      /* TO  */
+    EXIT = 271,                    /* EXIT  */
+    EDIT = 272,                    /* EDIT  */
+    RESET = 273,                   /* RESET  */
+    DEFEQ = 274,                   /* DEFEQ  */
+    OR = 275,                      /* OR  */
+    VALOF = 276,                   /* VALOF  */
+    IS = 277,                      /* IS  */
+    GIVES = 278,                   /* GIVES  */
+    THEN = 279,                    /* THEN  */
+    FORALL = 280,                  /* FORALL  */
+    MODSYM = 281,                  /* MODSYM  */
+    PUBCONST = 282,                /* PUBCONST  */
+    PUBFUN = 283,                  /* PUBFUN  */
+    PUBTYPE = 284,                 /* PUBTYPE  */
+    END = 285,                     /* END  */
+    MU = 286,                      /* MU  */
+    IN = 287,                      /* IN  */
+    WHERE = 288,                   /* WHERE  */
+    WHEREREC = 289,                /* WHEREREC  */
+    ELSE = 290,                    /* ELSE  */
+    BIN_BASE = 291,                /* BIN_BASE  */
+    LBINARY1 = 292,                /* LBINARY1  */
+    RBINARY1 = 293,                /* RBINARY1  */
+    LBINARY2 = 294,                /* LBINARY2  */
+    RBINARY2 = 295,                /* RBINARY2  */
+    LBINARY3 = 296,                /* LBINARY3  */
+    RBINARY3 = 297,                /* RBINARY3  */
+    LBINARY4 = 298,                /* LBINARY4  */
+    RBINARY4 = 299,                /* RBINARY4  */
+    LBINARY5 = 300,                /* LBINARY5  */
+    RBINARY5 = 301,                /* RBINARY5  */
+    LBINARY6 = 302,                /* LBINARY6  */
+    RBINARY6 = 303,                /* RBINARY6  */
+    LBINARY7 = 304,                /* LBINARY7  */
+    RBINARY7 = 305,                /* RBINARY7  */
+    LBINARY8 = 306,                /* LBINARY8  */
+    RBINARY8 = 307,                /* RBINARY8  */
+    LBINARY9 = 308,                /* LBINARY9  */
+    RBINARY9 = 309,                /* RBINARY9  */
+    APPLY = 310,                   /* APPLY  */
+    IDENT = 311,                   /* IDENT  */
+    NUMBER = 312,                  /* NUMBER  */
+    LITERAL = 313,                 /* LITERAL  */
+    CHAR = 314,                    /* CHAR  */
+    LET = 315,                     /* LET  */
+    LETREC = 316,                  /* LETREC  */
+    IF = 317,                      /* IF  */
+    LAMBDA = 318,                  /* LAMBDA  */
+    NONOP = 319,                   /* NONOP  */
+    ALWAYS_REDUCE = 320            /* ALWAYS_REDUCE  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define TYPEVAR 258
+#define ABSTYPE 259
+#define DATA 260
+#define TYPESYM 261
+#define DEC 262
+#define INFIX 263
+#define INFIXR 264
+#define USES 265
+#define PRIVATE 266
+#define DISPLAY 267
+#define SAVE 268
+#define WRITE 269
+#define TO 270
+#define EXIT 271
+#define EDIT 272
+#define RESET 273
+#define DEFEQ 274
+#define OR 275
+#define VALOF 276
+#define IS 277
+#define GIVES 278
+#define THEN 279
+#define FORALL 280
+#define MODSYM 281
+#define PUBCONST 282
+#define PUBFUN 283
+#define PUBTYPE 284
+#define END 285
+#define MU 286
+#define IN 287
+#define WHERE 288
+#define WHEREREC 289
+#define ELSE 290
+#define BIN_BASE 291
+#define LBINARY1 292
+#define RBINARY1 293
+#define LBINARY2 294
+#define RBINARY2 295
+#define LBINARY3 296
+#define RBINARY3 297
+#define LBINARY4 298
+#define RBINARY4 299
+#define LBINARY5 300
+#define RBINARY5 301
+#define LBINARY6 302
+#define RBINARY6 303
+#define LBINARY7 304
+#define RBINARY7 305
+#define LBINARY8 306
+#define RBINARY8 307
+#define LBINARY9 308
+#define RBINARY9 309
+#define APPLY 310
+#define IDENT 311
+#define NUMBER 312
+#define LITERAL 313
+#define CHAR 314
+#define LET 315
+#define LETREC 316
+#define IF 317
+#define LAMBDA 318
+#define NONOP 319
+#define ALWAYS_REDUCE 320
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
 
-#if ! defined (YYSTYPE) && ! defined (YYSTYPE_IS_DECLARED)
-typedef union YYSTYPE {
 	Num	numval;
 	int	intval;
 	Text	*textval;
@@ -226,16 +277,146 @@ typedef union YYSTYPE {
 	Expr	*expr;
 	Branch	*branch;
 	Cons	*cons;
-} YYSTYPE;
-/* Line 191 of yacc.c.  */
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
+
+
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
 #endif
 
 
+extern YYSTYPE yylval;
 
-/* Copy the second part of user declarations.  */
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_Y_TAB_H_INCLUDED  */
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_TYPEVAR = 3,                    /* TYPEVAR  */
+  YYSYMBOL_ABSTYPE = 4,                    /* ABSTYPE  */
+  YYSYMBOL_DATA = 5,                       /* DATA  */
+  YYSYMBOL_TYPESYM = 6,                    /* TYPESYM  */
+  YYSYMBOL_DEC = 7,                        /* DEC  */
+  YYSYMBOL_INFIX = 8,                      /* INFIX  */
+  YYSYMBOL_INFIXR = 9,                     /* INFIXR  */
+  YYSYMBOL_USES = 10,                      /* USES  */
+  YYSYMBOL_PRIVATE = 11,                   /* PRIVATE  */
+  YYSYMBOL_DISPLAY = 12,                   /* DISPLAY  */
+  YYSYMBOL_SAVE = 13,                      /* SAVE  */
+  YYSYMBOL_WRITE = 14,                     /* WRITE  */
+  YYSYMBOL_TO = 15,                        /* TO  */
+  YYSYMBOL_EXIT = 16,                      /* EXIT  */
+  YYSYMBOL_EDIT = 17,                      /* EDIT  */
+  YYSYMBOL_RESET = 18,                     /* RESET  */
+  YYSYMBOL_DEFEQ = 19,                     /* DEFEQ  */
+  YYSYMBOL_OR = 20,                        /* OR  */
+  YYSYMBOL_VALOF = 21,                     /* VALOF  */
+  YYSYMBOL_IS = 22,                        /* IS  */
+  YYSYMBOL_GIVES = 23,                     /* GIVES  */
+  YYSYMBOL_THEN = 24,                      /* THEN  */
+  YYSYMBOL_FORALL = 25,                    /* FORALL  */
+  YYSYMBOL_MODSYM = 26,                    /* MODSYM  */
+  YYSYMBOL_PUBCONST = 27,                  /* PUBCONST  */
+  YYSYMBOL_PUBFUN = 28,                    /* PUBFUN  */
+  YYSYMBOL_PUBTYPE = 29,                   /* PUBTYPE  */
+  YYSYMBOL_END = 30,                       /* END  */
+  YYSYMBOL_MU = 31,                        /* MU  */
+  YYSYMBOL_32_ = 32,                       /* ','  */
+  YYSYMBOL_33_ = 33,                       /* '|'  */
+  YYSYMBOL_IN = 34,                        /* IN  */
+  YYSYMBOL_WHERE = 35,                     /* WHERE  */
+  YYSYMBOL_WHEREREC = 36,                  /* WHEREREC  */
+  YYSYMBOL_ELSE = 37,                      /* ELSE  */
+  YYSYMBOL_BIN_BASE = 38,                  /* BIN_BASE  */
+  YYSYMBOL_LBINARY1 = 39,                  /* LBINARY1  */
+  YYSYMBOL_RBINARY1 = 40,                  /* RBINARY1  */
+  YYSYMBOL_LBINARY2 = 41,                  /* LBINARY2  */
+  YYSYMBOL_RBINARY2 = 42,                  /* RBINARY2  */
+  YYSYMBOL_LBINARY3 = 43,                  /* LBINARY3  */
+  YYSYMBOL_RBINARY3 = 44,                  /* RBINARY3  */
+  YYSYMBOL_LBINARY4 = 45,                  /* LBINARY4  */
+  YYSYMBOL_RBINARY4 = 46,                  /* RBINARY4  */
+  YYSYMBOL_LBINARY5 = 47,                  /* LBINARY5  */
+  YYSYMBOL_RBINARY5 = 48,                  /* RBINARY5  */
+  YYSYMBOL_LBINARY6 = 49,                  /* LBINARY6  */
+  YYSYMBOL_RBINARY6 = 50,                  /* RBINARY6  */
+  YYSYMBOL_LBINARY7 = 51,                  /* LBINARY7  */
+  YYSYMBOL_RBINARY7 = 52,                  /* RBINARY7  */
+  YYSYMBOL_LBINARY8 = 53,                  /* LBINARY8  */
+  YYSYMBOL_RBINARY8 = 54,                  /* RBINARY8  */
+  YYSYMBOL_LBINARY9 = 55,                  /* LBINARY9  */
+  YYSYMBOL_RBINARY9 = 56,                  /* RBINARY9  */
+  YYSYMBOL_APPLY = 57,                     /* APPLY  */
+  YYSYMBOL_IDENT = 58,                     /* IDENT  */
+  YYSYMBOL_NUMBER = 59,                    /* NUMBER  */
+  YYSYMBOL_LITERAL = 60,                   /* LITERAL  */
+  YYSYMBOL_CHAR = 61,                      /* CHAR  */
+  YYSYMBOL_LET = 62,                       /* LET  */
+  YYSYMBOL_LETREC = 63,                    /* LETREC  */
+  YYSYMBOL_IF = 64,                        /* IF  */
+  YYSYMBOL_LAMBDA = 65,                    /* LAMBDA  */
+  YYSYMBOL_66_ = 66,                       /* '('  */
+  YYSYMBOL_67_ = 67,                       /* '['  */
+  YYSYMBOL_NONOP = 68,                     /* NONOP  */
+  YYSYMBOL_ALWAYS_REDUCE = 69,             /* ALWAYS_REDUCE  */
+  YYSYMBOL_70_ = 70,                       /* ';'  */
+  YYSYMBOL_71_ = 71,                       /* ':'  */
+  YYSYMBOL_72_ = 72,                       /* ')'  */
+  YYSYMBOL_73_ = 73,                       /* ']'  */
+  YYSYMBOL_YYACCEPT = 74,                  /* $accept  */
+  YYSYMBOL_lines = 75,                     /* lines  */
+  YYSYMBOL_line = 76,                      /* line  */
+  YYSYMBOL_cmd = 77,                       /* cmd  */
+  YYSYMBOL_idlist = 78,                    /* idlist  */
+  YYSYMBOL_newtvlist = 79,                 /* newtvlist  */
+  YYSYMBOL_newtv = 80,                     /* newtv  */
+  YYSYMBOL_infixlist = 81,                 /* infixlist  */
+  YYSYMBOL_infixrlist = 82,                /* infixrlist  */
+  YYSYMBOL_precedence = 83,                /* precedence  */
+  YYSYMBOL_uselist = 84,                   /* uselist  */
+  YYSYMBOL_use = 85,                       /* use  */
+  YYSYMBOL_abstypelist = 86,               /* abstypelist  */
+  YYSYMBOL_abstype = 87,                   /* abstype  */
+  YYSYMBOL_newtype = 88,                   /* newtype  */
+  YYSYMBOL_tvargs = 89,                    /* tvargs  */
+  YYSYMBOL_tvlist = 90,                    /* tvlist  */
+  YYSYMBOL_tvpair = 91,                    /* tvpair  */
+  YYSYMBOL_tv = 92,                        /* tv  */
+  YYSYMBOL_constypelist = 93,              /* constypelist  */
+  YYSYMBOL_constype = 94,                  /* constype  */
+  YYSYMBOL_type = 95,                      /* type  */
+  YYSYMBOL_typeargs = 96,                  /* typeargs  */
+  YYSYMBOL_typearg = 97,                   /* typearg  */
+  YYSYMBOL_typelist = 98,                  /* typelist  */
+  YYSYMBOL_typepair = 99,                  /* typepair  */
+  YYSYMBOL_mu_tv = 100,                    /* mu_tv  */
+  YYSYMBOL_decl = 101,                     /* decl  */
+  YYSYMBOL_simple_decl = 102,              /* simple_decl  */
+  YYSYMBOL_q_type = 103,                   /* q_type  */
+  YYSYMBOL_start_dec = 104,                /* start_dec  */
+  YYSYMBOL_tuple = 105,                    /* tuple  */
+  YYSYMBOL_expr = 106,                     /* expr  */
+  YYSYMBOL_exprbody = 107,                 /* exprbody  */
+  YYSYMBOL_exprlist = 108,                 /* exprlist  */
+  YYSYMBOL_rulelist = 109,                 /* rulelist  */
+  YYSYMBOL_formals = 110,                  /* formals  */
+  YYSYMBOL_optend = 111,                   /* optend  */
+  YYSYMBOL_name = 112,                     /* name  */
+  YYSYMBOL_ident = 113,                    /* ident  */
+  YYSYMBOL_binop = 114                     /* binop  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+/* Second part of user prologue.  */
 
 /* Traditional yacc provides a global variable yyerrflag, which is
    non-zero when the parser is attempting to recover from an error.
@@ -244,7 +425,7 @@ typedef union YYSTYPE {
  */
 extern	int	yyerrflag;
 
-global Bool
+Bool
 recovering(void)
 {
 	return yyerrflag != 0;
@@ -260,139 +441,367 @@ int	yyerrflag;
 #endif
 
 
-/* Line 214 of yacc.c.  */
 
-#if ! defined (yyoverflow) || YYERROR_VERBOSE
+#ifdef short
+# undef short
+#endif
 
-/* The parser invokes alloca or malloc; define the necessary symbols.  */
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
 
-# if YYSTACK_USE_ALLOCA
-#  define YYSTACK_ALLOC alloca
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
 # else
-#  ifndef YYSTACK_USE_ALLOCA
-#   if defined (alloca) || defined (_ALLOCA_H)
-#    define YYSTACK_ALLOC alloca
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
 #   else
-#    ifdef __GNUC__
-#     define YYSTACK_ALLOC __builtin_alloca
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
 #    endif
 #   endif
 #  endif
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning. */
+   /* Pacify GCC's 'empty if-body' warning.  */
 #  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
 # else
-#  if defined (__STDC__) || defined (__cplusplus)
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#   define YYSIZE_T size_t
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
 #  endif
-#  define YYSTACK_ALLOC malloc
-#  define YYSTACK_FREE free
 # endif
-#endif /* ! defined (yyoverflow) || YYERROR_VERBOSE */
+#endif /* !defined yyoverflow */
 
-
-#if (! defined (yyoverflow) \
-     && (! defined (__cplusplus) \
-	 || (YYSTYPE_IS_TRIVIAL)))
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  short yyss;
-  YYSTYPE yyvs;
-  };
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (short) + sizeof (YYSTYPE))				\
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
-/* Copy COUNT objects from FROM to TO.  The source and destination do
-   not overlap.  */
-# ifndef YYCOPY
-#  if 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
-#  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  register YYSIZE_T yyi;		\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (0)
-#  endif
-# endif
+# define YYCOPY_NEEDED 1
 
 /* Relocate STACK from its old location to the new one.  The
    local variables YYSIZE and YYSTACKSIZE give the old and new number of
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack)					\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack, Stack, yysize);				\
-	Stack = &yyptr->Stack;						\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
     while (0)
 
 #endif
 
-#if defined (__STDC__) || defined (__cplusplus)
-   typedef signed char yysigned_char;
-#else
-   typedef short yysigned_char;
-#endif
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
 
-/* YYFINAL -- State number of the termination state. */
+/* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  2
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   1751
+#define YYLAST   1742
 
-/* YYNTOKENS -- Number of terminals. */
-#define YYNTOKENS  73
-/* YYNNTS -- Number of nonterminals. */
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  74
+/* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  41
-/* YYNRULES -- Number of rules. */
-#define YYNRULES  202
-/* YYNRULES -- Number of states. */
-#define YYNSTATES  401
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  203
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  402
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   319
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   320
 
-#define YYTRANSLATE(YYX) 						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
-static const unsigned char yytranslate[] =
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-      56,    71,     2,     2,    31,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,    70,    69,
+      66,    72,     2,     2,    32,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    71,    70,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,    57,     2,    72,     2,     2,     2,     2,     2,     2,
+       2,    67,     2,    73,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,    32,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,    33,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -408,834 +817,699 @@ static const unsigned char yytranslate[] =
        2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
        5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    33,    34,    35,    36,
+      25,    26,    27,    28,    29,    30,    31,    34,    35,    36,
       37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    48,    49,    50,    51,    52,    53,    54,    55,    58,
-      59,    60,    61,    62,    63,    64,    65,    66,    67,    68
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    65,    68,
+      69
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const unsigned short yyprhs[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,     0,     3,     6,     7,    10,    13,    16,    19,    22,
-      25,    30,    35,    37,    40,    42,    47,    51,    55,    57,
-      60,    65,    67,    70,    73,    75,    78,    80,    83,    86,
-      89,    92,    94,    95,    99,   101,   103,   107,   109,   113,
-     117,   121,   125,   127,   129,   133,   135,   139,   141,   143,
-     146,   151,   156,   160,   164,   168,   172,   176,   180,   184,
-     188,   192,   196,   200,   204,   208,   212,   216,   220,   224,
-     228,   229,   232,   234,   236,   240,   242,   244,   248,   251,
-     256,   260,   264,   268,   272,   276,   280,   284,   288,   292,
-     296,   300,   304,   308,   312,   316,   320,   324,   328,   331,
-     336,   340,   344,   348,   352,   356,   360,   364,   368,   372,
-     376,   380,   384,   388,   392,   396,   400,   404,   408,   413,
-     417,   418,   421,   423,   427,   429,   431,   435,   437,   439,
-     443,   447,   450,   451,   453,   457,   461,   463,   465,   467,
-     469,   474,   479,   483,   487,   490,   493,   497,   501,   505,
-     509,   513,   517,   521,   525,   529,   533,   537,   541,   545,
-     549,   553,   557,   561,   565,   569,   576,   583,   590,   596,
-     602,   607,   609,   613,   615,   619,   623,   629,   631,   632,
-     634,   636,   638,   640,   644,   647,   649,   651,   653,   655,
-     657,   659,   661,   663,   665,   667,   669,   671,   673,   675,
-     677,   679,   681
+       0,   178,   178,   179,   182,   183,   186,   187,   188,   190,
+     191,   193,   195,   196,   197,   198,   200,   202,   204,   205,
+     206,   208,   209,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,   220,   223,   224,   227,   228,   231,   234,
+     236,   240,   242,   246,   249,   250,   253,   256,   257,   260,
+     263,   264,   267,   269,   273,   277,   281,   285,   289,   293,
+     297,   301,   305,   309,   313,   317,   321,   325,   329,   333,
+     337,   343,   344,   347,   348,   351,   354,   357,   358,   366,
+     368,   370,   375,   380,   385,   390,   395,   400,   405,   410,
+     415,   420,   425,   430,   435,   440,   445,   450,   455,   463,
+     465,   467,   472,   477,   482,   487,   492,   497,   502,   507,
+     512,   517,   522,   527,   532,   537,   542,   547,   552,   557,
+     559,   562,   563,   567,   569,   572,   573,   576,   580,   583,
+     584,   587,   590,   593,   596,   597,   598,   601,   602,   603,
+     604,   605,   607,   609,   611,   613,   614,   616,   620,   624,
+     628,   632,   636,   640,   644,   648,   652,   656,   660,   664,
+     668,   672,   676,   680,   684,   688,   690,   692,   694,   696,
+     698,   700,   704,   705,   709,   712,   716,   718,   731,   742,
+     743,   746,   747,   750,   751,   752,   755,   756,   757,   758,
+     759,   760,   761,   762,   763,   764,   765,   766,   767,   768,
+     769,   770,   771,   772
 };
+#endif
 
-/* YYRHS -- A `-1'-separated list of the rules' RHS. */
-static const yysigned_char yyrhs[] =
-{
-      74,     0,    -1,    74,    75,    -1,    -1,    76,    69,    -1,
-       1,    69,    -1,     3,    78,    -1,     8,    80,    -1,     9,
-      81,    -1,     4,    85,    -1,     6,    87,    18,    94,    -1,
-       5,    87,    18,    92,    -1,    11,    -1,     7,   100,    -1,
-     101,    -1,    20,   105,    21,   106,    -1,   105,    21,   106,
-      -1,   105,    18,   106,    -1,   106,    -1,    14,   105,    -1,
-      14,   105,    15,    64,    -1,    12,    -1,    10,    83,    -1,
-      13,   112,    -1,    17,    -1,    17,   112,    -1,    16,    -1,
-      25,   112,    -1,    26,    77,    -1,    27,    77,    -1,    28,
-      77,    -1,    29,    -1,    -1,    77,    31,   112,    -1,   112,
-      -1,    79,    -1,    78,    31,    79,    -1,   112,    -1,    66,
-      70,    82,    -1,    66,    31,    80,    -1,    66,    70,    82,
-      -1,    66,    31,    81,    -1,    65,    -1,    84,    -1,    83,
-      31,    84,    -1,   112,    -1,    85,    31,    86,    -1,    86,
-      -1,    87,    -1,   112,    88,    -1,   112,    56,    91,    71,
-      -1,   112,    56,    90,    71,    -1,    91,    38,    91,    -1,
-      91,    39,    91,    -1,    91,    40,    91,    -1,    91,    41,
-      91,    -1,    91,    42,    91,    -1,    91,    43,    91,    -1,
-      91,    44,    91,    -1,    91,    45,    91,    -1,    91,    46,
-      91,    -1,    91,    47,    91,    -1,    91,    48,    91,    -1,
-      91,    49,    91,    -1,    91,    50,    91,    -1,    91,    51,
-      91,    -1,    91,    52,    91,    -1,    91,    53,    91,    -1,
-      91,    54,    91,    -1,    91,    55,    91,    -1,    -1,    91,
-      88,    -1,    91,    -1,    90,    -1,    91,    31,    89,    -1,
-     112,    -1,    93,    -1,    93,    19,    92,    -1,   112,    95,
-      -1,   112,    56,    98,    71,    -1,    94,    38,    94,    -1,
-      94,    39,    94,    -1,    94,    40,    94,    -1,    94,    41,
-      94,    -1,    94,    42,    94,    -1,    94,    43,    94,    -1,
-      94,    44,    94,    -1,    94,    45,    94,    -1,    94,    46,
-      94,    -1,    94,    47,    94,    -1,    94,    48,    94,    -1,
-      94,    49,    94,    -1,    94,    50,    94,    -1,    94,    51,
-      94,    -1,    94,    52,    94,    -1,    94,    53,    94,    -1,
-      94,    54,    94,    -1,    94,    55,    94,    -1,   112,    95,
-      -1,   112,    56,    98,    71,    -1,    94,    38,    94,    -1,
-      94,    39,    94,    -1,    94,    40,    94,    -1,    94,    41,
-      94,    -1,    94,    42,    94,    -1,    94,    43,    94,    -1,
-      94,    44,    94,    -1,    94,    45,    94,    -1,    94,    46,
-      94,    -1,    94,    47,    94,    -1,    94,    48,    94,    -1,
-      94,    49,    94,    -1,    94,    50,    94,    -1,    94,    51,
-      94,    -1,    94,    52,    94,    -1,    94,    53,    94,    -1,
-      94,    54,    94,    -1,    94,    55,    94,    -1,    30,    99,
-      22,    94,    -1,    56,    94,    71,    -1,    -1,    96,    95,
-      -1,   112,    -1,    56,    94,    71,    -1,    94,    -1,    98,
-      -1,    94,    31,    97,    -1,   112,    -1,   101,    -1,   111,
-      31,   100,    -1,   111,    70,   102,    -1,   103,    94,    -1,
-      -1,   112,    -1,   104,    31,   104,    -1,    56,   104,    71,
-      -1,   112,    -1,    65,    -1,    64,    -1,    63,    -1,    56,
-     105,   113,    71,    -1,    56,   113,   105,    71,    -1,    56,
-     106,    71,    -1,    57,   107,    72,    -1,    57,    72,    -1,
-     105,   105,    -1,   105,    38,   105,    -1,   105,    39,   105,
-      -1,   105,    40,   105,    -1,   105,    41,   105,    -1,   105,
-      42,   105,    -1,   105,    43,   105,    -1,   105,    44,   105,
-      -1,   105,    45,   105,    -1,   105,    46,   105,    -1,   105,
-      47,   105,    -1,   105,    48,   105,    -1,   105,    49,   105,
-      -1,   105,    50,   105,    -1,   105,    51,   105,    -1,   105,
-      52,   105,    -1,   105,    53,   105,    -1,   105,    54,   105,
-      -1,   105,    55,   105,    -1,    59,   108,   110,    -1,    60,
-     105,    23,   106,    36,   105,    -1,    62,   106,    18,   106,
-      33,   105,    -1,    61,   104,    18,   106,    33,   105,    -1,
-     105,    35,   106,    18,   105,    -1,   105,    34,   104,    18,
-     105,    -1,    30,   104,    22,   105,    -1,   105,    -1,   105,
-      31,   106,    -1,   105,    -1,   105,    31,   107,    -1,   109,
-      22,   105,    -1,   109,    22,   105,    32,   108,    -1,   106,
-      -1,    -1,    29,    -1,   112,    -1,   113,    -1,    66,    -1,
-      56,   113,    71,    -1,    58,   113,    -1,    38,    -1,    39,
-      -1,    40,    -1,    41,    -1,    42,    -1,    43,    -1,    44,
-      -1,    45,    -1,    46,    -1,    47,    -1,    48,    -1,    49,
-      -1,    50,    -1,    51,    -1,    52,    -1,    53,    -1,    54,
-      -1,    55,    -1
-};
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const unsigned short yyrline[] =
-{
-       0,   177,   177,   178,   181,   182,   185,   186,   187,   189,
-     190,   192,   194,   195,   196,   197,   199,   201,   203,   204,
-     205,   207,   208,   209,   210,   211,   212,   213,   214,   215,
-     216,   217,   218,   221,   222,   225,   226,   229,   232,   234,
-     238,   240,   244,   247,   248,   251,   254,   255,   258,   261,
-     262,   265,   267,   271,   275,   279,   283,   287,   291,   295,
-     299,   303,   307,   311,   315,   319,   323,   327,   331,   335,
-     341,   342,   345,   346,   349,   352,   355,   356,   364,   366,
-     368,   373,   378,   383,   388,   393,   398,   403,   408,   413,
-     418,   423,   428,   433,   438,   443,   448,   453,   461,   463,
-     465,   470,   475,   480,   485,   490,   495,   500,   505,   510,
-     515,   520,   525,   530,   535,   540,   545,   550,   555,   557,
-     560,   561,   565,   567,   570,   571,   574,   578,   581,   582,
-     585,   588,   591,   594,   595,   596,   599,   600,   601,   602,
-     603,   605,   607,   609,   611,   612,   614,   618,   622,   626,
-     630,   634,   638,   642,   646,   650,   654,   658,   662,   666,
-     670,   674,   678,   682,   686,   688,   690,   692,   694,   696,
-     698,   702,   703,   707,   710,   714,   716,   729,   740,   741,
-     744,   745,   748,   749,   750,   753,   754,   755,   756,   757,
-     758,   759,   760,   761,   762,   763,   764,   765,   766,   767,
-     768,   769,   770
-};
-#endif
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-#if YYDEBUG || YYERROR_VERBOSE
-/* YYTNME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-   First, the terminals, then, starting at YYNTOKENS, nonterminals. */
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "TYPEVAR", "ABSTYPE", "DATA", "TYPESYM", 
-  "DEC", "INFIX", "INFIXR", "USES", "PRIVATE", "DISPLAY", "SAVE", "WRITE", 
-  "TO", "EXIT", "EDIT", "DEFEQ", "OR", "VALOF", "IS", "GIVES", "THEN", 
-  "FORALL", "MODSYM", "PUBCONST", "PUBFUN", "PUBTYPE", "END", "MU", "','", 
-  "'|'", "IN", "WHEREREC", "WHERE", "ELSE", "BIN_BASE", "LBINARY1", 
-  "RBINARY1", "LBINARY2", "RBINARY2", "LBINARY3", "RBINARY3", "LBINARY4", 
-  "RBINARY4", "LBINARY5", "RBINARY5", "LBINARY6", "RBINARY6", "LBINARY7", 
-  "RBINARY7", "LBINARY8", "RBINARY8", "LBINARY9", "RBINARY9", "'('", 
-  "'['", "NONOP", "LAMBDA", "IF", "LETREC", "LET", "CHAR", "LITERAL", 
-  "NUMBER", "IDENT", "APPLY", "ALWAYS_REDUCE", "';'", "':'", "')'", "']'", 
-  "$accept", "lines", "line", "cmd", "idlist", "newtvlist", "newtv", 
-  "infixlist", "infixrlist", "precedence", "uselist", "use", 
-  "abstypelist", "abstype", "newtype", "tvargs", "tvlist", "tvpair", "tv", 
-  "constypelist", "constype", "type", "typeargs", "typearg", "typelist", 
-  "typepair", "mu_tv", "decl", "simple_decl", "q_type", "start_dec", 
-  "tuple", "expr", "exprbody", "exprlist", "rulelist", "formals", 
-  "optend", "name", "ident", "binop", 0
+  "\"end of file\"", "error", "\"invalid token\"", "TYPEVAR", "ABSTYPE",
+  "DATA", "TYPESYM", "DEC", "INFIX", "INFIXR", "USES", "PRIVATE",
+  "DISPLAY", "SAVE", "WRITE", "TO", "EXIT", "EDIT", "RESET", "DEFEQ", "OR",
+  "VALOF", "IS", "GIVES", "THEN", "FORALL", "MODSYM", "PUBCONST", "PUBFUN",
+  "PUBTYPE", "END", "MU", "','", "'|'", "IN", "WHERE", "WHEREREC", "ELSE",
+  "BIN_BASE", "LBINARY1", "RBINARY1", "LBINARY2", "RBINARY2", "LBINARY3",
+  "RBINARY3", "LBINARY4", "RBINARY4", "LBINARY5", "RBINARY5", "LBINARY6",
+  "RBINARY6", "LBINARY7", "RBINARY7", "LBINARY8", "RBINARY8", "LBINARY9",
+  "RBINARY9", "APPLY", "IDENT", "NUMBER", "LITERAL", "CHAR", "LET",
+  "LETREC", "IF", "LAMBDA", "'('", "'['", "NONOP", "ALWAYS_REDUCE", "';'",
+  "':'", "')'", "']'", "$accept", "lines", "line", "cmd", "idlist",
+  "newtvlist", "newtv", "infixlist", "infixrlist", "precedence", "uselist",
+  "use", "abstypelist", "abstype", "newtype", "tvargs", "tvlist", "tvpair",
+  "tv", "constypelist", "constype", "type", "typeargs", "typearg",
+  "typelist", "typepair", "mu_tv", "decl", "simple_decl", "q_type",
+  "start_dec", "tuple", "expr", "exprbody", "exprlist", "rulelist",
+  "formals", "optend", "name", "ident", "binop", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const unsigned short yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,    44,   124,   286,   287,   288,   289,   290,   291,   292,
-     293,   294,   295,   296,   297,   298,   299,   300,   301,   302,
-     303,   304,   305,   306,   307,   308,    40,    91,   309,   310,
-     311,   312,   313,   314,   315,   316,   317,   318,   319,    59,
-      58,    41,    93
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const unsigned char yyr1[] =
-{
-       0,    73,    74,    74,    75,    75,    76,    76,    76,    76,
-      76,    76,    76,    76,    76,    76,    76,    76,    76,    76,
-      76,    76,    76,    76,    76,    76,    76,    76,    76,    76,
-      76,    76,    76,    77,    77,    78,    78,    79,    80,    80,
-      81,    81,    82,    83,    83,    84,    85,    85,    86,    87,
-      87,    87,    87,    87,    87,    87,    87,    87,    87,    87,
-      87,    87,    87,    87,    87,    87,    87,    87,    87,    87,
-      88,    88,    89,    89,    90,    91,    92,    92,    93,    93,
-      93,    93,    93,    93,    93,    93,    93,    93,    93,    93,
-      93,    93,    93,    93,    93,    93,    93,    93,    94,    94,
-      94,    94,    94,    94,    94,    94,    94,    94,    94,    94,
-      94,    94,    94,    94,    94,    94,    94,    94,    94,    94,
-      95,    95,    96,    96,    97,    97,    98,    99,   100,   100,
-     101,   102,   103,   104,   104,   104,   105,   105,   105,   105,
-     105,   105,   105,   105,   105,   105,   105,   105,   105,   105,
-     105,   105,   105,   105,   105,   105,   105,   105,   105,   105,
-     105,   105,   105,   105,   105,   105,   105,   105,   105,   105,
-     105,   106,   106,   107,   107,   108,   108,   109,   110,   110,
-     111,   111,   112,   112,   112,   113,   113,   113,   113,   113,
-     113,   113,   113,   113,   113,   113,   113,   113,   113,   113,
-     113,   113,   113
-};
+#define YYPACT_NINF (-334)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const unsigned char yyr2[] =
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-182)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
 {
-       0,     2,     2,     0,     2,     2,     2,     2,     2,     2,
-       4,     4,     1,     2,     1,     4,     3,     3,     1,     2,
-       4,     1,     2,     2,     1,     2,     1,     2,     2,     2,
-       2,     1,     0,     3,     1,     1,     3,     1,     3,     3,
-       3,     3,     1,     1,     3,     1,     3,     1,     1,     2,
-       4,     4,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       0,     2,     1,     1,     3,     1,     1,     3,     2,     4,
-       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     2,     4,
-       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     4,     3,
-       0,     2,     1,     3,     1,     1,     3,     1,     1,     3,
-       3,     2,     0,     1,     3,     3,     1,     1,     1,     1,
-       4,     4,     3,     3,     2,     2,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     6,     6,     6,     5,     5,
-       4,     1,     3,     1,     3,     3,     5,     1,     0,     1,
-       1,     1,     1,     3,     2,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1
+    -334,   449,  -334,   -39,   -23,   -23,   -23,   -23,  1333,   -11,
+       5,   -23,  -334,  -334,   -23,  1135,  -334,   -23,  -334,  1135,
+     -23,   -23,   -23,   -23,  -334,    -8,  -334,  -334,  -334,  -334,
+    -334,  -334,  -334,  -334,  -334,  -334,  -334,  -334,  -334,  -334,
+    -334,  -334,  -334,  -334,  -334,  -334,  -334,  -334,  1135,    -8,
+    1135,  1135,  1071,   821,  1562,  -334,     0,  -334,   703,  -334,
+      26,    31,  -334,  -334,  1562,    37,  -334,  -334,    46,  -334,
+    -334,  1580,    -4,    84,    86,  -334,  -334,    -6,  -334,     1,
+    -334,     6,  -334,    88,  -334,  -334,  -334,   491,  -334,  -334,
+     750,  -334,    93,  -334,    93,    93,  1363,     2,  -334,   957,
+      99,    -5,   795,  -334,    96,   108,   995,    62,   886,  -334,
+    1033,    89,  -334,  -334,  1135,  1135,  1135,  1135,    -8,  1135,
+    1135,  1135,  1135,  1135,  1135,  1135,  1135,  1135,  1135,  1135,
+    1135,  1135,  1135,  1135,  1135,  1135,  1135,  -334,  -334,   100,
+     -23,   -23,   -23,   -23,   -23,   -23,   -23,   -23,   -23,   -23,
+     -23,   -23,   -23,   -23,   -23,   -23,   -23,   -23,   -23,   -23,
+    1333,  -334,   -23,  -334,   -22,   -22,  1333,   -11,   115,     5,
+     115,   -23,   118,  1135,   -23,   -21,  1135,    -8,  1135,  1135,
+    1135,  -334,  -334,  1135,  1135,  1135,  1135,  1135,  1135,  1135,
+    1135,  1135,  1135,  1135,  1135,  1135,  1135,  1135,  1135,  1135,
+    1135,  1135,   103,  -334,  -334,   860,  1135,  -334,  -334,  -334,
+    -334,   152,    10,  1392,  1392,  1419,  1419,  1444,  1444,  1492,
+    1492,  1513,  1513,  1532,  1532,  1674,  1674,   875,   875,  1236,
+    1236,  -334,   -22,  -334,  -334,  -334,  -334,  -334,  -334,  -334,
+    -334,  -334,  -334,  -334,  -334,  -334,  -334,  -334,  -334,  -334,
+    -334,  -334,  -334,   109,   -20,  -334,   -23,  1109,  -334,   163,
+    1598,    30,  1616,    61,  -334,  -334,  -334,  -334,  -334,  -334,
+    -334,  -334,  -334,  -334,  -334,  1205,   160,   150,   161,   159,
+    1171,  -334,  -334,  -334,  1135,  1135,  1616,  -334,   -23,  -334,
+     175,  -334,  1235,   -22,   -22,   -22,   -22,   -22,   -22,   -22,
+     -22,   -22,   -22,   -22,   -22,   -22,   -22,   -22,   -22,   -22,
+     -22,   -22,  1109,    -3,   111,  -334,   -22,   -22,   -22,   -22,
+     -22,   -22,   -22,   -22,   -22,   -22,   -22,   -22,   -22,   -22,
+     -22,   -22,   -22,   -22,  1109,  -334,  1135,  1135,  1135,  1135,
+    1303,  1303,  -334,  -334,   165,   -22,  -334,  -334,  1634,  1652,
+     540,   577,   614,   651,    60,   662,   174,   587,   183,   548,
+      29,   294,   112,   508,    17,    19,   923,   168,  1109,  -334,
+    1669,  1669,   822,   822,  1134,  1134,  1280,  1280,   600,   600,
+     196,   196,    38,    38,   135,   135,   176,   176,   169,  1205,
+    1205,  1303,  -334,  1616,   -22,  -334,    -2,  1269,  -334,  1481,
+    -334,  -334
 };
 
-/* YYDEFACT[STATE-NAME] -- Default rule to reduce with in state
-   STATE-NUM when YYTABLE doesn't specify something else to do.  Zero
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
    means the default is an error.  */
-static const unsigned char yydefact[] =
+static const yytype_uint8 yydefact[] =
 {
        3,     0,     1,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    12,    21,     0,     0,    26,    24,     0,     0,
-       0,     0,     0,    31,     0,   185,   186,   187,   188,   189,
+       0,     0,    12,    21,     0,     0,    27,    25,    22,     0,
+       0,     0,     0,     0,    32,     0,   186,   187,   188,   189,
      190,   191,   192,   193,   194,   195,   196,   197,   198,   199,
-     200,   201,   202,     0,     0,     0,     0,     0,     0,     0,
-     139,   138,   137,   182,     2,     0,    14,   171,    18,     0,
-     136,   181,     5,     0,     6,    35,    37,     9,    47,    48,
-       0,    75,     0,     0,    13,   128,     0,   180,     0,     7,
-       0,     8,    22,    43,    45,    23,    19,   136,    25,     0,
-      27,    28,    34,    29,    30,     0,     0,   133,   171,     0,
-       0,   144,   173,     0,   184,   171,   177,   178,     0,     0,
-       0,     0,     4,     0,     0,     0,     0,     0,     0,     0,
+     200,   201,   202,   203,   183,   138,   139,   140,     0,     0,
+       0,     0,     0,     0,     0,     2,     0,    14,   172,    18,
+       0,   137,   182,     5,     0,     6,    36,    38,     9,    48,
+      49,     0,    76,     0,     0,    13,   129,     0,   181,     0,
+       7,     0,     8,    23,    44,    46,    24,    19,   137,    26,
+       0,    28,    29,    35,    30,    31,     0,     0,   134,   172,
+       0,     0,     0,   178,   179,     0,   172,     0,     0,   145,
+     174,     0,   185,     4,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   146,   133,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   145,   132,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    50,    71,    76,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      49,    70,    75,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   185,   186,   187,
-     188,   189,   190,   191,   192,   193,   194,   195,   196,   197,
-     198,   199,   200,   201,   202,     0,   142,   183,     0,     0,
-     143,   179,   164,     0,     0,     0,     0,    17,    16,   172,
-       0,     0,   146,   147,   148,   149,   150,   151,   152,   153,
+       0,   180,   165,     0,   186,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+     202,   203,     0,   143,   184,     0,     0,   144,    17,    16,
+     173,     0,     0,   147,   148,   149,   150,   151,   152,   153,
      154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
-     130,     0,    36,    46,    52,    53,    54,    55,    56,    57,
+     164,   131,     0,    37,    47,    53,    54,    55,    56,    57,
       58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
-      68,    69,     0,     0,    71,     0,     0,    11,    76,     0,
-     120,    10,   120,   129,    39,    42,    38,    41,    40,    44,
-      20,    15,    33,   135,   170,   134,   140,   141,   174,   175,
-       0,     0,     0,     0,     0,   131,    51,     0,    50,     0,
-     127,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      68,    69,    70,     0,     0,    72,     0,     0,    11,    77,
+       0,   121,    10,   121,   130,    40,    43,    39,    42,    41,
+      45,    20,    15,    34,   136,   171,   135,     0,     0,     0,
+     176,   141,   142,   175,     0,     0,   132,    52,     0,    51,
+       0,   128,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    98,   120,   122,     0,     0,     0,     0,     0,
+       0,     0,     0,    99,   121,   123,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    98,     0,     0,     0,     0,   169,
-     168,    74,    73,    72,     0,   119,    77,    80,    81,   102,
+       0,     0,     0,     0,     0,    99,     0,     0,     0,     0,
+     169,   170,    75,    74,    73,     0,   120,    78,    81,    82,
      103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,   117,     0,     0,     0,   121,   100,
+     113,   114,   115,   116,   117,   118,     0,     0,     0,   122,
      101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
-     111,   112,   113,   114,   115,   116,   117,     0,   176,   165,
-     167,   166,   118,     0,   123,    99,     0,    99,   124,   126,
-     125
+     111,   112,   113,   114,   115,   116,   117,   118,     0,   167,
+     168,   166,   177,   119,     0,   124,   100,     0,   100,   125,
+     127,   126
 };
 
-/* YYDEFGOTO[NTERM-NUM]. */
-static const short yydefgoto[] =
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
 {
-      -1,     1,    54,    55,    91,    64,    65,    79,    81,   266,
-      82,    83,    67,    68,    69,   160,   341,   252,    70,   257,
-     258,   259,   312,   313,   399,   366,   289,    74,    75,   230,
-     231,    96,   136,   106,   103,   107,   108,   202,    76,    87,
-     138
+    -334,  -334,  -334,  -334,    18,  -334,   102,    76,    90,    87,
+    -334,    83,  -334,   125,    50,   105,  -334,    47,   284,    41,
+    -334,    80,  -261,  -334,  -334,  -333,  -334,   122,   288,  -334,
+    -334,   -17,    85,     7,   130,   -49,  -334,  -334,   337,    -1,
+      22
 };
 
-/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-   STATE-NUM.  */
-#define YYPACT_NINF -302
-static const short yypact[] =
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
 {
-    -302,   646,  -302,   -40,   -28,   -28,   -28,   -28,  1369,   -29,
-     -24,   -28,  -302,  -302,   -28,  1243,  -302,   -28,  1243,   -28,
-     -28,   -28,   -28,  -302,   -25,  -302,  -302,  -302,  -302,  -302,
-    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
-    -302,  -302,  -302,  1179,   922,  1547,  1243,  1243,   -25,  1243,
-    -302,  -302,  -302,  -302,  -302,   -21,  -302,   795,  -302,   -18,
-     -15,  -302,  -302,  1547,    29,  -302,  -302,    65,  -302,  -302,
-    1565,    -7,    51,    96,  -302,  -302,    -9,  -302,    -6,  -302,
-      35,  -302,    98,  -302,  -302,  -302,   698,  -302,  -302,   841,
-    -302,    99,  -302,    99,    99,  1398,   143,  -302,  1068,    60,
-     998,  -302,  1105,    62,  -302,  1142,  -302,   103,   113,   885,
-       8,   119,  -302,  1243,  1243,  1243,   -25,  1243,  1243,  1243,
-    1243,  1243,  1243,  1243,  1243,  1243,  1243,  1243,  1243,  1243,
-    1243,  1243,  1243,  1243,  1243,  1243,  -302,  -302,    90,   -28,
-     -28,   -28,   -28,   -28,   -28,   -28,   -28,   -28,   -28,   -28,
-     -28,   -28,   -28,   -28,   -28,   -28,   -28,   -28,   -28,  1369,
-    -302,   -28,  -302,    67,    67,  1369,   -29,   102,   -24,   102,
-     -28,   104,  1243,   -28,   -17,  1243,   -25,  1243,  1243,  1243,
-    1243,  1243,  1243,  1243,  1243,  1243,  1243,  1243,  1243,  1243,
-    1243,  1243,  1243,  1243,  1243,   105,  -302,  -302,   961,  1243,
-    -302,  -302,  -302,  1243,  1243,  1243,  1243,  -302,  -302,  -302,
-       9,   155,  1426,  1426,  1452,  1452,  1476,  1476,  1498,  1498,
-    1518,  1518,  1572,  1572,   724,   724,  1230,  1230,   661,   661,
-    -302,    67,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
-    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
-    -302,  -302,   107,    27,  -302,   -28,  1216,  -302,   158,  1601,
-      50,  1619,    61,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
-    -302,  -302,  -302,  -302,  1311,   149,  -302,  -302,  -302,  1278,
-     171,   175,   181,  1243,  1243,  1619,  -302,   -28,  -302,   194,
-    -302,   918,    67,    67,    67,    67,    67,    67,    67,    67,
-      67,    67,    67,    67,    67,    67,    67,    67,    67,    67,
-      67,  1216,    -4,    70,  -302,    67,    67,    67,    67,    67,
-      67,    67,    67,    67,    67,    67,    67,    67,    67,    67,
-      67,    67,    67,  1216,  -302,  1243,  1243,  1243,  1243,  1340,
-    1340,  -302,  -302,   187,    67,  -302,  -302,  1637,  1655,   140,
-     191,   350,   574,   151,   746,   421,   755,   372,   429,    49,
-     196,   203,   209,    -2,    38,  1034,   148,  1216,  -302,  1672,
-    1672,   310,   310,  1685,  1685,  1696,  1696,   287,   287,   230,
-     230,   172,   172,   -19,   -19,   166,   166,   160,  -302,  1340,
-    1311,  1311,  1619,    67,  -302,    26,   995,  -302,   556,  -302,
-    -302
+       0,     1,    55,    56,    92,    65,    66,    80,    82,   267,
+      83,    84,    68,    69,    70,   161,   342,   253,    71,   258,
+     259,   260,   313,   314,   400,   367,   290,    75,    76,   231,
+     232,    97,   137,   103,   111,   104,   105,   182,    77,    88,
+     139
 };
 
-/* YYPGOTO[NTERM-NUM].  */
-static const short yypgoto[] =
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
 {
-    -302,  -302,  -302,  -302,    88,  -302,   114,    63,    84,    97,
-    -302,   100,  -302,   127,   106,   108,  -302,   -16,   -70,    -3,
-    -302,   246,  -250,  -302,  -302,  -301,  -302,   109,   267,  -302,
-    -302,    -5,   332,     7,    74,   -60,  -302,  -302,   275,    -1,
-       1
-};
-
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
-   number is the opposite.  If zero, do what YYDEFACT says.
-   If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -181
-static const short yytable[] =
-{
-      60,   161,    61,    66,    71,    71,    71,    77,    58,    61,
-      84,   -70,   334,    85,   176,   -78,    88,   -96,    90,    92,
-      92,    92,   165,    97,   -70,   166,   205,   283,    63,    62,
-      45,    95,   387,    45,   330,   331,   332,    78,    53,   176,
-     176,    53,    80,   110,   100,   -79,   104,    97,   112,   159,
-      99,    45,   137,   332,   273,  -180,   111,   -97,   287,    53,
-     139,   137,   -70,   368,   167,   -78,   168,   -96,   -92,   163,
-     162,   234,   235,   236,   237,   238,   239,   240,   241,   242,
-     243,   244,   245,   246,   247,   248,   249,   250,   251,   253,
-     174,   161,   400,   332,    97,   -79,   140,   255,   288,   195,
-     328,   329,   330,   331,   332,   169,   311,   -97,    45,    93,
-      94,   210,    72,    73,   164,    97,    53,   333,   -92,    45,
-     207,   208,   209,   256,   211,    45,   367,    53,    45,   170,
-     173,   196,   201,    53,   200,   203,    53,   206,    66,    71,
-     162,   162,   162,   162,   162,   162,   162,   162,   162,   162,
-     162,   162,   162,   162,   162,   162,   162,   162,   162,   -82,
-     162,   197,   260,   262,    77,   175,    61,   265,   270,    84,
-     -86,   275,   272,   284,   176,    97,   276,   292,   286,   271,
-     176,   318,   319,   320,   321,   322,   323,   324,   325,   326,
-     327,   328,   329,   330,   331,   332,   322,   323,   324,   325,
-     326,   327,   328,   329,   330,   331,   332,   336,   337,   -82,
-     -83,   280,   281,   282,   338,   -93,   344,   343,   287,   395,
-     -86,   332,   -94,   328,   329,   330,   331,   332,   -95,   264,
-     262,   397,   318,   319,   320,   321,   322,   323,   324,   325,
-     326,   327,   328,   329,   330,   331,   332,   328,   329,   330,
-     331,   332,   267,   232,   290,   262,   330,   331,   332,   314,
-     -83,   314,   330,   331,   332,   -93,   268,   233,    56,   254,
-     269,   342,   -94,   278,   263,   388,    59,     0,   -95,   326,
-     327,   328,   329,   330,   331,   332,   162,     0,     0,   346,
-       0,   260,   262,   262,   262,   262,   262,   262,   262,   262,
-     262,   262,   262,   262,   262,   262,   262,   262,   262,   262,
-     262,     0,   314,     0,   262,   262,   262,   262,   262,   262,
-     262,   262,   262,   262,   262,   262,   262,   262,   262,   262,
-     262,   262,   262,    57,   324,   325,   326,   327,   328,   329,
-     330,   331,   332,   262,     0,     0,     0,    86,     0,     0,
-      89,   318,   319,   320,   321,   322,   323,   324,   325,   326,
-     327,   328,   329,   330,   331,   332,   262,     0,     0,   -84,
-       0,     0,     0,     0,     0,    98,   102,     0,   105,   109,
-       0,   105,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   -90,   262,   320,   321,   322,   323,   324,   325,   326,
-     327,   328,   329,   330,   331,   332,     0,     0,     0,     0,
-     261,     0,     0,     0,     0,     0,     0,     0,     0,   -84,
-       0,   326,   327,   328,   329,   330,   331,   332,     0,     0,
-       0,     0,   198,     0,     0,     0,     0,     0,     0,     0,
-     -88,   -90,     0,     0,     0,   105,   105,   105,   -91,   105,
-     212,   213,   214,   215,   216,   217,   218,   219,   220,   221,
-     222,   223,   224,   225,   226,   227,   228,   229,   324,   325,
-     326,   327,   328,   329,   330,   331,   332,   285,   326,   327,
-     328,   329,   330,   331,   332,     0,     0,     0,     0,     0,
-     -88,     0,     0,     0,     0,     0,     0,     0,   -91,     0,
-       0,     0,   291,     0,   105,     0,     0,   274,     0,   212,
-     213,   214,   215,   216,   217,   218,   219,   220,   221,   222,
-     223,   224,   225,   226,   227,   228,   229,     0,     0,     0,
-       0,   102,     0,     0,     0,   279,   105,   105,   105,   347,
-     348,   349,   350,   351,   352,   353,   354,   355,   356,   357,
-     358,   359,   360,   361,   362,   363,   364,   365,     0,     0,
-       0,   369,   370,   371,   372,   373,   374,   375,   376,   377,
-     378,   379,   380,   381,   382,   383,   384,   385,   386,   365,
-       0,     0,     0,     0,     0,     0,     0,   393,     0,     0,
-     392,     0,     0,   -85,   315,   316,   317,   318,   319,   320,
-     321,   322,   323,   324,   325,   326,   327,   328,   329,   330,
-     331,   332,     0,   396,     0,   339,   340,   320,   321,   322,
+      61,   388,   335,    67,    72,    72,    72,    78,    59,   256,
+      85,   177,   288,    86,   179,   -71,    89,   -79,   -80,    91,
+      93,    93,    93,    62,    98,   176,   166,   177,   -71,   285,
+      62,    63,   101,   167,   177,    44,    44,   -97,   169,   -98,
+      94,    95,   177,    64,   257,    54,    54,    79,    98,   -93,
+      44,   274,   289,   369,    44,   100,    73,    74,    96,   107,
+      54,   401,   160,    81,    54,   138,   -71,   -79,   -80,   140,
+     113,   163,   168,   333,   108,   333,   112,   170,   141,   175,
+     -87,   329,   330,   331,   332,   333,    58,   -97,    44,   -98,
+     329,   330,   331,   332,   333,    98,   312,   138,    54,   -93,
+      87,   212,  -181,   164,    90,   165,   323,   324,   325,   326,
+     327,   328,   329,   330,   331,   332,   333,    98,   178,    44,
+     171,   208,   209,   210,   211,   174,   181,   334,   202,    54,
+     -87,   183,   -95,    99,   203,   102,    99,   106,   110,    67,
+      72,   163,   163,   163,   163,   163,   163,   163,   163,   163,
+     163,   163,   163,   163,   163,   163,   163,   163,   163,   163,
+     276,   163,   207,   261,   263,    78,   331,   332,   333,    44,
+      85,   284,   204,   273,   266,   281,    98,   368,   271,    54,
+     272,   287,   -95,   293,   336,   277,   278,   279,    62,   331,
+     332,   333,   177,   205,   -89,   337,   338,   288,   345,    99,
+      99,    99,    99,   -91,   213,   214,   215,   216,   217,   218,
+     219,   220,   221,   222,   223,   224,   225,   226,   227,   228,
+     229,   230,   325,   326,   327,   328,   329,   330,   331,   332,
+     333,   263,   333,   327,   328,   329,   330,   331,   332,   333,
+     396,   398,   233,   265,   -89,   262,   327,   328,   329,   330,
+     331,   332,   333,   -91,   270,   291,   263,   269,    99,   268,
+     315,   275,   315,    99,    99,    99,   234,   255,   280,   213,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
+     224,   225,   226,   227,   228,   229,   230,   163,   264,    57,
+     392,   110,   261,   263,   263,   263,   263,   263,   263,   263,
+     263,   263,   263,   263,   263,   263,   263,   263,   263,   263,
+     263,   263,   286,   315,   -94,   263,   263,   263,   263,   263,
+     263,   263,   263,   263,   263,   263,   263,   263,   263,   263,
+     263,   263,   263,   263,   347,   343,   283,   292,    60,     0,
+       0,     0,     0,     0,   263,     0,   329,   330,   331,   332,
+     333,     0,     0,     0,     0,     0,   162,     0,     0,     0,
+       0,     0,     0,     0,   -94,     0,     0,   263,     0,   340,
+     341,     0,     0,     0,   348,   349,   350,   351,   352,   353,
+     354,   355,   356,   357,   358,   359,   360,   361,   362,   363,
+     364,   365,   366,   263,     0,     0,   370,   371,   372,   373,
+     374,   375,   376,   377,   378,   379,   380,   381,   382,   383,
+     384,   385,   386,   387,   366,     0,     0,     0,     0,     0,
+       0,   389,   390,   391,    99,   393,   235,   236,   237,   238,
+     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
+     249,   250,   251,   252,   254,     0,   162,     0,   397,     2,
+       3,     0,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,     0,    16,    17,    18,     0,     0,
+      19,     0,     0,     0,   399,    20,    21,    22,    23,    24,
+      25,     0,     0,     0,     0,     0,     0,     0,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,   172,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,     0,   -33,
+       0,     0,    25,     0,     0,     0,   117,   118,   -96,     0,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,     0,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+     -83,     0,   331,   332,   333,     0,     0,     0,   -92,     0,
+       0,     0,   344,     0,     0,     0,     0,     0,   -96,     0,
+       0,     0,   319,   320,   321,   322,   323,   324,   325,   326,
+     327,   328,   329,   330,   331,   332,   333,   -84,   327,   328,
+     329,   330,   331,   332,   333,     0,     0,   -90,     0,     0,
+     -83,     0,     0,     0,     0,     0,     0,     0,   -92,   319,
+     320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
+     330,   331,   332,   333,   -85,   325,   326,   327,   328,   329,
+     330,   331,   332,   333,     0,     0,     0,   -84,   325,   326,
+     327,   328,   329,   330,   331,   332,   333,   -90,   321,   322,
      323,   324,   325,   326,   327,   328,   329,   330,   331,   332,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   398,
-       0,     0,     0,   -85,     0,     0,     2,     3,     0,     4,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,     0,    16,    17,     0,     0,    18,   105,   389,   390,
-     391,    19,    20,    21,    22,    23,    24,     0,     0,     0,
-       0,     0,     0,     0,    25,    26,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,    52,    53,   171,     0,   -32,   135,    43,    44,    45,
-      46,    47,    48,    49,    50,    51,    52,    53,    24,     0,
-       0,     0,   116,   117,     0,     0,   118,   119,   120,   121,
-     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
-     132,   133,   134,   135,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,    53,   -87,     0,     0,     0,     0,
-       0,     0,     0,     0,   -89,   131,   132,   133,   134,   135,
-      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
-      53,   322,   323,   324,   325,   326,   327,   328,   329,   330,
-     331,   332,   324,   325,   326,   327,   328,   329,   330,   331,
-     332,     0,     0,   113,     0,   -87,   114,     0,     0,     0,
-       0,     0,     0,     0,   -89,    24,   115,     0,     0,   116,
-     117,     0,     0,   118,   119,   120,   121,   122,   123,   124,
+     333,   -86,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   -88,     0,   -85,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   321,   322,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,   332,   333,   323,   324,
+     325,   326,   327,   328,   329,   330,   331,   332,   333,     0,
+       0,   -86,   114,     0,     0,   115,     0,     0,     0,     0,
+       0,     0,   -88,     0,    25,   116,     0,     0,   117,   118,
+       0,     0,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+       0,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,   173,     0,     0,     0,     0,     0,     0,     0,
+       0,    25,     0,     0,     0,   117,   118,     0,     0,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,     0,    44,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,   180,
+       0,     0,     0,     0,     0,     0,    25,     0,     0,     0,
+     117,   118,     0,     0,   119,   120,   121,   122,   123,   124,
      125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
-     135,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,   172,     0,     0,     0,     0,     0,     0,     0,
-       0,    24,     0,     0,     0,   116,   117,     0,     0,   118,
+     135,   136,    25,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,   319,   320,   321,   322,   323,   324,
+     325,   326,   327,   328,   329,   330,   331,   332,   333,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+       0,    25,     0,     0,   109,   117,   118,     0,     0,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,    25,    44,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,   134,
+     135,   136,   282,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,   394,     0,     0,   204,     0,
+       0,     0,   316,   317,   318,   319,   320,   321,   322,   323,
+     324,   325,   326,   327,   328,   329,   330,   331,   332,   333,
+       0,     0,     0,     0,     0,     0,     0,     0,    25,   116,
+       0,     0,   117,   118,     0,   395,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,   135,   136,     0,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    25,   116,     0,     0,
+     117,   118,     0,     0,   184,   185,   186,   187,   188,   189,
+     190,   191,   192,   193,   194,   195,   196,   197,   198,   199,
+     200,   201,     0,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    25,   206,     0,     0,   117,   118,
+       0,     0,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+       0,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    25,     0,     0,     0,     0,     0,     0,     0,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,     0,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+     256,     0,     0,     0,     0,     0,     0,     0,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,    25,    44,     0,     0,
+       0,     0,     0,     0,     0,   257,     0,    54,   321,   322,
+     323,   324,   325,   326,   327,   328,   329,   330,   331,   332,
+     333,     0,     0,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,   339,     0,   117,   118,     0,     0,
      119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-     129,   130,   131,   132,   133,   134,   135,    43,    44,    45,
-      46,    47,    48,    49,    50,    51,    52,    53,   204,     0,
-       0,     0,     0,     0,     0,    24,     0,     0,     0,   116,
-     117,     0,     0,   118,   119,   120,   121,   122,   123,   124,
+     129,   130,   131,   132,   133,   134,   135,   136,     0,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+     117,   118,     0,     0,   119,   120,   121,   122,   123,   124,
      125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
-     135,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    24,     0,     0,     0,   315,   316,   317,   318,
-     319,   320,   321,   322,   323,   324,   325,   326,   327,   328,
-     329,   330,   331,   332,     0,     0,     0,     0,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,   345,
-       0,    24,     0,     0,   101,   116,   117,     0,     0,   118,
-     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-     129,   130,   131,   132,   133,   134,   135,    43,    44,    45,
-      46,    47,    48,    49,    50,    51,    52,    53,    24,     0,
-       0,     0,   277,   315,   316,   317,   318,   319,   320,   321,
+     135,   136,     0,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,   316,   317,   318,   319,   320,   321,
      322,   323,   324,   325,   326,   327,   328,   329,   330,   331,
-     332,     0,     0,     0,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,    53,   393,   394,     0,     0,   197,
-       0,     0,   315,   316,   317,   318,   319,   320,   321,   322,
-     323,   324,   325,   326,   327,   328,   329,   330,   331,   332,
-       0,     0,     0,     0,     0,     0,     0,     0,    24,   115,
-       0,     0,   116,   117,     0,   394,   177,   178,   179,   180,
-     181,   182,   183,   184,   185,   186,   187,   188,   189,   190,
-     191,   192,   193,   194,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,    53,    24,   199,     0,     0,   116,
-     117,     0,     0,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
-     135,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    24,   115,     0,     0,   116,   117,     0,     0,
-     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
-     128,   129,   130,   131,   132,   133,   134,   135,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    24,
-       0,     0,     0,     0,     0,     0,     0,    25,    26,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      48,    49,    50,    51,    52,    53,   255,     0,     0,     0,
-       0,     0,     0,     0,    25,    26,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,   256,    24,    45,     0,     0,     0,     0,     0,
-       0,     0,    53,   133,   134,   135,    43,    44,    45,    46,
-      47,    48,    49,    50,    51,    52,    53,     0,     0,    43,
+     332,   333,   136,     0,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,     0,     0,   346,   316,   317,
+     318,   319,   320,   321,   322,   323,   324,   325,   326,   327,
+     328,   329,   330,   331,   332,   333,   323,   324,   325,   326,
+     327,   328,   329,   330,   331,   332,   333,     0,     0,     0,
+       0,   395,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+       0,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+       0,    44,     0,     0,     0,     0,     0,     0,     0,    64,
+       0,    54,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+       0,    44,     0,     0,     0,     0,     0,     0,     0,    96,
+       0,    54,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,     0,
       44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
-     335,     0,   116,   117,     0,     0,   118,   119,   120,   121,
-     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
-     132,   133,   134,   135,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,    53,   116,   117,     0,     0,   118,
-     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-     129,   130,   131,   132,   133,   134,   135,    43,    44,    45,
-      46,    47,    48,    49,    50,    51,    52,    53,   118,   119,
-     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
-     130,   131,   132,   133,   134,   135,    43,    44,    45,    46,
-      47,    48,    49,    50,    51,    52,    53,    25,    26,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    63,     0,    45,     0,     0,
-       0,     0,     0,     0,     0,    53,    25,    26,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    95,     0,    45,     0,     0,     0,
-       0,     0,     0,     0,    53,   119,   120,   121,   122,   123,
-     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
-     134,   135,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,    52,    53,   121,   122,   123,   124,   125,   126,   127,
-     128,   129,   130,   131,   132,   133,   134,   135,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,   123,
-     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
-     134,   135,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,    52,    53,   125,   126,   127,   128,   129,   130,   131,
-     132,   133,   134,   135,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,    53,   127,   128,   129,   130,   131,
-     132,   133,   134,   135,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,    53,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,   141,   142,   143,   144,   145,   146,   147,
-     148,   149,   150,   151,   152,   153,   154,   155,   156,   157,
-     158,   129,   130,   131,   132,   133,   134,   135,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,   293,
-     294,   295,   296,   297,   298,   299,   300,   301,   302,   303,
-     304,   305,   306,   307,   308,   309,   310,   315,   316,   317,
+      54,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,     0,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,     0,    44,    45,    46,    47,    48,    49,    50,    51,
+      52,    53,    54,   394,     0,     0,     0,     0,     0,     0,
+     316,   317,   318,   319,   320,   321,   322,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,   332,   333,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,     0,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+       0,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,   130,   131,   132,   133,   134,   135,   136,     0,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,   156,   157,   158,   159,   294,   295,   296,
+     297,   298,   299,   300,   301,   302,   303,   304,   305,   306,
+     307,   308,   309,   310,   311,   316,   317,   318,   319,   320,
+     321,   322,   323,   324,   325,   326,   327,   328,   329,   330,
+     331,   332,   333,  -101,   317,   318,   319,   320,   321,   322,
+     323,   324,   325,   326,   327,   328,   329,   330,   331,   332,
+     333,  -102,   317,   318,   319,   320,   321,   322,   323,   324,
+     325,   326,   327,   328,   329,   330,   331,   332,   333,   317,
      318,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-     328,   329,   330,   331,   332,  -100,   316,   317,   318,   319,
-     320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
-     330,   331,   332,  -101,   316,   317,   318,   319,   320,   321,
-     322,   323,   324,   325,   326,   327,   328,   329,   330,   331,
-     332,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   320,   321,
-     322,   323,   324,   325,   326,   327,   328,   329,   330,   331,
-     332,   322,   323,   324,   325,   326,   327,   328,   329,   330,
-     331,   332
+     328,   329,   330,   331,   332,   333,   132,   133,   134,   135,
+     136,     0,    44,    45,    46,    47,    48,    49,    50,    51,
+      52,    53,    54
 };
 
-static const short yycheck[] =
+static const yytype_int16 yycheck[] =
 {
-       1,    71,     1,     4,     5,     6,     7,     8,     1,     8,
-      11,    18,   262,    14,    31,    19,    17,    19,    19,    20,
-      21,    22,    31,    24,    31,    31,    18,    18,    56,    69,
-      58,    56,   333,    58,    53,    54,    55,    66,    66,    31,
-      31,    66,    66,    48,    43,    19,    45,    48,    69,    56,
-      43,    58,    70,    55,    71,    70,    49,    19,    31,    66,
-      31,    70,    69,   313,    70,    69,    31,    69,    19,    18,
-      71,   141,   142,   143,   144,   145,   146,   147,   148,   149,
-     150,   151,   152,   153,   154,   155,   156,   157,   158,   159,
-      95,   161,   393,    55,    95,    69,    31,    30,    71,    98,
-      51,    52,    53,    54,    55,    70,    56,    69,    58,    21,
-      22,   116,     6,     7,    18,   116,    66,    56,    69,    58,
-     113,   114,   115,    56,   117,    58,    56,    66,    58,    31,
-      31,    71,    29,    66,    72,    22,    66,    18,   139,   140,
+       1,   334,   263,     4,     5,     6,     7,     8,     1,    31,
+      11,    32,    32,    14,    19,    19,    17,    20,    20,    20,
+      21,    22,    23,     1,    25,    23,    32,    32,    32,    19,
+       8,    70,    49,    32,    32,    58,    58,    20,    32,    20,
+      22,    23,    32,    66,    66,    68,    68,    58,    49,    20,
+      58,    72,    72,   314,    58,    48,     6,     7,    66,    52,
+      68,   394,    66,    58,    68,    71,    70,    70,    70,    32,
+      70,    72,    71,    56,    52,    56,    54,    71,    32,    96,
+      20,    52,    53,    54,    55,    56,     1,    70,    58,    70,
+      52,    53,    54,    55,    56,    96,    66,    71,    68,    70,
+      15,   118,    71,    19,    19,    19,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,   118,    19,    58,
+      32,   114,   115,   116,   117,    32,    30,    66,   106,    68,
+      70,    23,    20,    48,    72,    50,    51,    52,    53,   140,
      141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
-     151,   152,   153,   154,   155,   156,   157,   158,   159,    19,
-     161,    71,   163,   164,   165,    22,   165,    65,    64,   170,
-      19,   176,   173,    18,    31,   176,    71,    19,    71,   172,
-      31,    41,    42,    43,    44,    45,    46,    47,    48,    49,
-      50,    51,    52,    53,    54,    55,    45,    46,    47,    48,
-      49,    50,    51,    52,    53,    54,    55,    36,    33,    69,
-      19,   204,   205,   206,    33,    19,    22,   287,    31,    71,
-      69,    55,    19,    51,    52,    53,    54,    55,    19,   166,
-     231,    71,    41,    42,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,    53,    54,    55,    51,    52,    53,
-      54,    55,   168,   139,   255,   256,    53,    54,    55,   260,
-      69,   262,    53,    54,    55,    69,   169,   140,     1,   161,
-     170,   287,    69,   199,   165,   335,     1,    -1,    69,    49,
-      50,    51,    52,    53,    54,    55,   287,    -1,    -1,   292,
-      -1,   292,   293,   294,   295,   296,   297,   298,   299,   300,
+     151,   152,   153,   154,   155,   156,   157,   158,   159,   160,
+     177,   162,    73,   164,   165,   166,    54,    55,    56,    58,
+     171,    19,    72,   174,    59,    72,   177,    66,    60,    68,
+     173,    72,    70,    20,    34,   178,   179,   180,   166,    54,
+      55,    56,    32,   108,    20,    34,    37,    32,    23,   114,
+     115,   116,   117,    20,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,    48,    49,    50,    51,    52,    53,    54,    55,
+      56,   232,    56,    50,    51,    52,    53,    54,    55,    56,
+      72,    72,   140,   167,    70,   165,    50,    51,    52,    53,
+      54,    55,    56,    70,   171,   256,   257,   170,   173,   169,
+     261,   176,   263,   178,   179,   180,   141,   162,   183,   184,
+     185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
+     195,   196,   197,   198,   199,   200,   201,   288,   166,     1,
+     339,   206,   293,   294,   295,   296,   297,   298,   299,   300,
      301,   302,   303,   304,   305,   306,   307,   308,   309,   310,
-     311,    -1,   313,    -1,   315,   316,   317,   318,   319,   320,
+     311,   312,   232,   314,    20,   316,   317,   318,   319,   320,
      321,   322,   323,   324,   325,   326,   327,   328,   329,   330,
-     331,   332,   333,     1,    47,    48,    49,    50,    51,    52,
-      53,    54,    55,   344,    -1,    -1,    -1,    15,    -1,    -1,
-      18,    41,    42,    43,    44,    45,    46,    47,    48,    49,
-      50,    51,    52,    53,    54,    55,   367,    -1,    -1,    19,
-      -1,    -1,    -1,    -1,    -1,    43,    44,    -1,    46,    47,
-      -1,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    19,   393,    43,    44,    45,    46,    47,    48,    49,
-      50,    51,    52,    53,    54,    55,    -1,    -1,    -1,    -1,
-     164,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,
-      -1,    49,    50,    51,    52,    53,    54,    55,    -1,    -1,
-      -1,    -1,   100,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      19,    69,    -1,    -1,    -1,   113,   114,   115,    19,   117,
-     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
-     128,   129,   130,   131,   132,   133,   134,   135,    47,    48,
-      49,    50,    51,    52,    53,    54,    55,   231,    49,    50,
-      51,    52,    53,    54,    55,    -1,    -1,    -1,    -1,    -1,
-      69,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,    -1,
-      -1,    -1,   256,    -1,   172,    -1,    -1,   175,    -1,   177,
-     178,   179,   180,   181,   182,   183,   184,   185,   186,   187,
-     188,   189,   190,   191,   192,   193,   194,    -1,    -1,    -1,
-      -1,   199,    -1,    -1,    -1,   203,   204,   205,   206,   293,
-     294,   295,   296,   297,   298,   299,   300,   301,   302,   303,
-     304,   305,   306,   307,   308,   309,   310,   311,    -1,    -1,
-      -1,   315,   316,   317,   318,   319,   320,   321,   322,   323,
-     324,   325,   326,   327,   328,   329,   330,   331,   332,   333,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    31,    -1,    -1,
-     344,    -1,    -1,    19,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
-      54,    55,    -1,   367,    -1,   283,   284,    43,    44,    45,
+     331,   332,   333,   334,   293,   288,   206,   257,     1,    -1,
+      -1,    -1,    -1,    -1,   345,    -1,    52,    53,    54,    55,
+      56,    -1,    -1,    -1,    -1,    -1,    72,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    70,    -1,    -1,   368,    -1,   284,
+     285,    -1,    -1,    -1,   294,   295,   296,   297,   298,   299,
+     300,   301,   302,   303,   304,   305,   306,   307,   308,   309,
+     310,   311,   312,   394,    -1,    -1,   316,   317,   318,   319,
+     320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
+     330,   331,   332,   333,   334,    -1,    -1,    -1,    -1,    -1,
+      -1,   336,   337,   338,   339,   345,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,   157,   158,   159,   160,    -1,   162,    -1,   368,     0,
+       1,    -1,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    -1,    16,    17,    18,    -1,    -1,
+      21,    -1,    -1,    -1,   394,    26,    27,    28,    29,    30,
+      31,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,    56,    15,    58,    59,    60,
+      61,    62,    63,    64,    65,    66,    67,    68,    -1,    70,
+      -1,    -1,    31,    -1,    -1,    -1,    35,    36,    20,    -1,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    -1,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      20,    -1,    54,    55,    56,    -1,    -1,    -1,    20,    -1,
+      -1,    -1,   288,    -1,    -1,    -1,    -1,    -1,    70,    -1,
+      -1,    -1,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    20,    50,    51,
+      52,    53,    54,    55,    56,    -1,    -1,    20,    -1,    -1,
+      70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    70,    42,
+      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    20,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    -1,    -1,    -1,    70,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    70,    44,    45,
       46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   393,
-      -1,    -1,    -1,    69,    -1,    -1,     0,     1,    -1,     3,
-       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-      14,    -1,    16,    17,    -1,    -1,    20,   335,   336,   337,
-     338,    25,    26,    27,    28,    29,    30,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
-      64,    65,    66,    15,    -1,    69,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    64,    65,    66,    30,    -1,
-      -1,    -1,    34,    35,    -1,    -1,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
-      62,    63,    64,    65,    66,    19,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    19,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
-      66,    45,    46,    47,    48,    49,    50,    51,    52,    53,
-      54,    55,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    -1,    -1,    18,    -1,    69,    21,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    69,    30,    31,    -1,    -1,    34,
-      35,    -1,    -1,    38,    39,    40,    41,    42,    43,    44,
+      56,    20,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    20,    -1,    70,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    -1,
+      -1,    70,    19,    -1,    -1,    22,    -1,    -1,    -1,    -1,
+      -1,    -1,    70,    -1,    31,    32,    -1,    -1,    35,    36,
+      -1,    -1,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      -1,    58,    59,    60,    61,    62,    63,    64,    65,    66,
+      67,    68,    22,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    31,    -1,    -1,    -1,    35,    36,    -1,    -1,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    -1,    58,    59,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    24,
+      -1,    -1,    -1,    -1,    -1,    -1,    31,    -1,    -1,    -1,
+      35,    36,    -1,    -1,    39,    40,    41,    42,    43,    44,
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    21,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    30,    -1,    -1,    -1,    34,    35,    -1,    -1,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    64,    65,    66,    23,    -1,
-      -1,    -1,    -1,    -1,    -1,    30,    -1,    -1,    -1,    34,
-      35,    -1,    -1,    38,    39,    40,    41,    42,    43,    44,
+      55,    56,    31,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      -1,    31,    -1,    -1,    73,    35,    36,    -1,    -1,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    31,    58,    59,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    54,
+      55,    56,    72,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    32,    -1,    -1,    72,    -1,
+      -1,    -1,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    31,    32,
+      -1,    -1,    35,    36,    -1,    72,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    -1,    58,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    31,    32,    -1,    -1,
+      35,    36,    -1,    -1,    39,    40,    41,    42,    43,    44,
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    30,    -1,    -1,    -1,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    -1,    -1,    -1,    -1,    56,    57,
-      58,    59,    60,    61,    62,    63,    64,    65,    66,    71,
-      -1,    30,    -1,    -1,    72,    34,    35,    -1,    -1,    38,
+      55,    56,    -1,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    31,    32,    -1,    -1,    35,    36,
+      -1,    -1,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      -1,    58,    59,    60,    61,    62,    63,    64,    65,    66,
+      67,    68,    31,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    64,    65,    66,    30,    -1,
-      -1,    -1,    71,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    -1,    -1,    -1,    56,    57,    58,    59,    60,    61,
-      62,    63,    64,    65,    66,    31,    71,    -1,    -1,    71,
-      -1,    -1,    38,    39,    40,    41,    42,    43,    44,    45,
+      49,    50,    51,    52,    53,    54,    55,    56,    -1,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      31,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,    56,    31,    58,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    66,    -1,    68,    44,    45,
       46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    30,    31,
-      -1,    -1,    34,    35,    -1,    71,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
-      62,    63,    64,    65,    66,    30,    31,    -1,    -1,    34,
-      35,    -1,    -1,    38,    39,    40,    41,    42,    43,    44,
+      56,    -1,    -1,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    33,    -1,    35,    36,    -1,    -1,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    -1,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      35,    36,    -1,    -1,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    -1,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    39,    40,    41,    42,    43,    44,
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    30,    31,    -1,    -1,    34,    35,    -1,    -1,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,    60,    61,    62,    63,    64,    65,    66,    30,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    38,    39,    40,
+      55,    56,    56,    -1,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    -1,    -1,    72,    39,    40,
       41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,    63,    64,    65,    66,    30,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    38,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
-      54,    55,    56,    30,    58,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    66,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,    62,    63,    64,    65,    66,    -1,    -1,    56,
-      57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
-      32,    -1,    34,    35,    -1,    -1,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
-      62,    63,    64,    65,    66,    34,    35,    -1,    -1,    38,
+      51,    52,    53,    54,    55,    56,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    -1,    -1,    -1,
+      -1,    72,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      -1,    58,    59,    60,    61,    62,    63,    64,    65,    66,
+      67,    68,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      -1,    58,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    66,
+      -1,    68,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      -1,    58,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    66,
+      -1,    68,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    -1,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,    56,    -1,    58,    59,    60,
+      61,    62,    63,    64,    65,    66,    67,    68,    44,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
+      56,    -1,    58,    59,    60,    61,    62,    63,    64,    65,
+      66,    67,    68,    32,    -1,    -1,    -1,    -1,    -1,    -1,
       39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
-      59,    60,    61,    62,    63,    64,    65,    66,    38,    39,
+      49,    50,    51,    52,    53,    54,    55,    56,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    -1,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      -1,    58,    59,    60,    61,    62,    63,    64,    65,    66,
+      67,    68,    50,    51,    52,    53,    54,    55,    56,    -1,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
+      68,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    39,
       40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,    62,    63,    64,    65,    66,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,    52,    53,    54,    55,    56,    -1,    58,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    66,    38,    39,    40,    41,
+      50,    51,    52,    53,    54,    55,    56,    39,    40,    41,
       42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    56,    -1,    58,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    66,    39,    40,    41,    42,    43,
-      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
-      64,    65,    66,    41,    42,    43,    44,    45,    46,    47,
-      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,    60,    61,    62,    63,    64,    65,    66,    43,
+      52,    53,    54,    55,    56,    39,    40,    41,    42,    43,
       44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
-      64,    65,    66,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
-      62,    63,    64,    65,    66,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
-      62,    63,    64,    65,    66,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
-      53,    54,    55,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    49,    50,    51,    52,    53,    54,    55,    56,    57,
-      58,    59,    60,    61,    62,    63,    64,    65,    66,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,    53,    54,    55,    38,    39,    40,
+      54,    55,    56,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
+      56,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    40,
       41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,    52,    53,    54,    55,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
-      53,    54,    55,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      48,    49,    50,    51,    52,    53,    54,    55,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    45,    46,    47,    48,    49,    50,    51,    52,    53,
-      54,    55
+      51,    52,    53,    54,    55,    56,    52,    53,    54,    55,
+      56,    -1,    58,    59,    60,    61,    62,    63,    64,    65,
+      66,    67,    68
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const unsigned char yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
 {
-       0,    74,     0,     1,     3,     4,     5,     6,     7,     8,
-       9,    10,    11,    12,    13,    14,    16,    17,    20,    25,
-      26,    27,    28,    29,    30,    38,    39,    40,    41,    42,
+       0,    75,     0,     1,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    16,    17,    18,    21,
+      26,    27,    28,    29,    30,    31,    39,    40,    41,    42,
       43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
-      63,    64,    65,    66,    75,    76,   101,   105,   106,   111,
-     112,   113,    69,    56,    78,    79,   112,    85,    86,    87,
-      91,   112,    87,    87,   100,   101,   111,   112,    66,    80,
-      66,    81,    83,    84,   112,   112,   105,   112,   112,   105,
-     112,    77,   112,    77,    77,    56,   104,   112,   105,   106,
-     113,    72,   105,   107,   113,   105,   106,   108,   109,   105,
-     104,   106,    69,    18,    21,    31,    34,    35,    38,    39,
+      53,    54,    55,    56,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    76,    77,   102,   106,   107,
+     112,   113,   114,    70,    66,    79,    80,   113,    86,    87,
+      88,    92,   113,    88,    88,   101,   102,   112,   113,    58,
+      81,    58,    82,    84,    85,   113,   113,   106,   113,   113,
+     106,   113,    78,   113,    78,    78,    66,   105,   113,   106,
+     107,   105,   106,   107,   109,   110,   106,   107,   114,    73,
+     106,   108,   114,    70,    19,    22,    32,    35,    36,    39,
       40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
-      50,    51,    52,    53,    54,    55,   105,    70,   113,    31,
-      31,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      50,    51,    52,    53,    54,    55,    56,   106,    71,   114,
+      32,    32,    39,    40,    41,    42,    43,    44,    45,    46,
       47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
-      88,    91,   112,    18,    18,    31,    31,    70,    31,    70,
-      31,    15,    21,    31,   104,    22,    31,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,    52,    53,    54,    55,   113,    71,    71,   105,    31,
-      72,    29,   110,    22,    23,    18,    18,   106,   106,   106,
-     104,   106,   105,   105,   105,   105,   105,   105,   105,   105,
-     105,   105,   105,   105,   105,   105,   105,   105,   105,   105,
-     102,   103,    79,    86,    91,    91,    91,    91,    91,    91,
-      91,    91,    91,    91,    91,    91,    91,    91,    91,    91,
-      91,    91,    90,    91,    88,    30,    56,    92,    93,    94,
-     112,    94,   112,   100,    80,    65,    82,    81,    82,    84,
-      64,   106,   112,    71,   105,   104,    71,    71,   107,   105,
-     106,   106,   106,    18,    18,    94,    71,    31,    71,    99,
-     112,    94,    19,    38,    39,    40,    41,    42,    43,    44,
+      66,    89,    92,   113,    19,    19,    32,    32,    71,    32,
+      71,    32,    15,    22,    32,   105,    23,    32,    19,    19,
+      24,    30,   111,    23,    39,    40,    41,    42,    43,    44,
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    95,    96,   112,    38,    39,    40,    41,    42,
+      55,    56,   114,    72,    72,   106,    32,    73,   107,   107,
+     107,   107,   105,   106,   106,   106,   106,   106,   106,   106,
+     106,   106,   106,   106,   106,   106,   106,   106,   106,   106,
+     106,   103,   104,    80,    87,    92,    92,    92,    92,    92,
+      92,    92,    92,    92,    92,    92,    92,    92,    92,    92,
+      92,    92,    92,    91,    92,    89,    31,    66,    93,    94,
+      95,   113,    95,   113,   101,    81,    59,    83,    82,    83,
+      85,    60,   107,   113,    72,   106,   105,   107,   107,   107,
+     106,    72,    72,   108,    19,    19,    95,    72,    32,    72,
+     100,   113,    95,    20,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    66,    96,    97,   113,    39,    40,    41,    42,
       43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
-      53,    54,    55,    56,    95,    32,    36,    33,    33,   105,
-     105,    89,    90,    91,    22,    71,    92,    94,    94,    94,
-      94,    94,    94,    94,    94,    94,    94,    94,    94,    94,
-      94,    94,    94,    94,    94,    94,    98,    56,    95,    94,
+      53,    54,    55,    56,    66,    96,    34,    34,    37,    33,
+     106,   106,    90,    91,    92,    23,    72,    93,    95,    95,
+      95,    95,    95,    95,    95,    95,    95,    95,    95,    95,
+      95,    95,    95,    95,    95,    95,    95,    99,    66,    96,
+      95,    95,    95,    95,    95,    95,    95,    95,    95,    95,
+      95,    95,    95,    95,    95,    95,    95,    95,    99,   106,
+     106,   106,   109,    95,    32,    72,    72,    95,    72,    95,
+      98,    99
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    74,    75,    75,    76,    76,    77,    77,    77,    77,
+      77,    77,    77,    77,    77,    77,    77,    77,    77,    77,
+      77,    77,    77,    77,    77,    77,    77,    77,    77,    77,
+      77,    77,    77,    77,    78,    78,    79,    79,    80,    81,
+      81,    82,    82,    83,    84,    84,    85,    86,    86,    87,
+      88,    88,    88,    88,    88,    88,    88,    88,    88,    88,
+      88,    88,    88,    88,    88,    88,    88,    88,    88,    88,
+      88,    89,    89,    90,    90,    91,    92,    93,    93,    94,
       94,    94,    94,    94,    94,    94,    94,    94,    94,    94,
-      94,    94,    94,    94,    94,    94,    94,    98,   108,   105,
-     105,   105,    94,    31,    71,    71,    94,    71,    94,    97,
-      98
+      94,    94,    94,    94,    94,    94,    94,    94,    94,    95,
+      95,    95,    95,    95,    95,    95,    95,    95,    95,    95,
+      95,    95,    95,    95,    95,    95,    95,    95,    95,    95,
+      95,    96,    96,    97,    97,    98,    98,    99,   100,   101,
+     101,   102,   103,   104,   105,   105,   105,   106,   106,   106,
+     106,   106,   106,   106,   106,   106,   106,   106,   106,   106,
+     106,   106,   106,   106,   106,   106,   106,   106,   106,   106,
+     106,   106,   106,   106,   106,   106,   106,   106,   106,   106,
+     106,   106,   107,   107,   108,   108,   109,   109,   110,   111,
+     111,   112,   112,   113,   113,   113,   114,   114,   114,   114,
+     114,   114,   114,   114,   114,   114,   114,   114,   114,   114,
+     114,   114,   114,   114
 };
 
-#if ! defined (YYSIZE_T) && defined (__SIZE_TYPE__)
-# define YYSIZE_T __SIZE_TYPE__
-#endif
-#if ! defined (YYSIZE_T) && defined (size_t)
-# define YYSIZE_T size_t
-#endif
-#if ! defined (YYSIZE_T)
-# if defined (__STDC__) || defined (__cplusplus)
-#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
-#  define YYSIZE_T size_t
-# endif
-#endif
-#if ! defined (YYSIZE_T)
-# define YYSIZE_T unsigned int
-#endif
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     2,     0,     2,     2,     2,     2,     2,     2,
+       4,     4,     1,     2,     1,     4,     3,     3,     1,     2,
+       4,     1,     1,     2,     2,     1,     2,     1,     2,     2,
+       2,     2,     1,     0,     3,     1,     1,     3,     1,     3,
+       3,     3,     3,     1,     1,     3,     1,     3,     1,     1,
+       2,     4,     4,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     0,     2,     1,     1,     3,     1,     1,     3,     2,
+       4,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     2,
+       4,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     4,
+       3,     0,     2,     1,     3,     1,     1,     3,     1,     1,
+       3,     3,     2,     0,     1,     3,     3,     1,     1,     1,
+       1,     4,     4,     3,     3,     2,     2,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     6,     6,     6,     5,
+       5,     4,     1,     3,     1,     3,     3,     5,     1,     0,
+       1,     1,     1,     1,     3,     2,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1
+};
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
 
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrlab1
+enum { YYENOMEM = -2 };
 
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
 
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  */
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
-#define YYFAIL		goto yyerrlab
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      yytoken = YYTRANSLATE (yychar);				\
-      YYPOPSTACK;						\
-      goto yybackup;						\
-    }								\
-  else								\
-    { 								\
-      yyerror ("syntax error: cannot back up");\
-      YYERROR;							\
-    }								\
-while (0)
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-/* YYLLOC_DEFAULT -- Compute the default location (before the actions
-   are run).  */
-
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)         \
-  Current.first_line   = Rhs[1].first_line;      \
-  Current.first_column = Rhs[1].first_column;    \
-  Current.last_line    = Rhs[N].last_line;       \
-  Current.last_column  = Rhs[N].last_column;
-#endif
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
-
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (YYLEX_PARAM)
-#else
-# define YYLEX yylex ()
-#endif
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -1245,54 +1519,81 @@ while (0)
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
 } while (0)
 
-# define YYDSYMPRINT(Args)			\
-do {						\
-  if (yydebug)					\
-    yysymprint Args;				\
-} while (0)
 
-# define YYDSYMPRINTF(Title, Token, Value, Location)		\
-do {								\
-  if (yydebug)							\
-    {								\
-      YYFPRINTF (stderr, "%s ", Title);				\
-      yysymprint (stderr, 					\
-                  Token, Value);	\
-      YYFPRINTF (stderr, "\n");					\
-    }								\
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
 } while (0)
 
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
 /*------------------------------------------------------------------.
 | yy_stack_print -- Print the state stack from its BOTTOM up to its |
-| TOP (cinluded).                                                   |
+| TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if defined (__STDC__) || defined (__cplusplus)
 static void
-yy_stack_print (short *bottom, short *top)
-#else
-static void
-yy_stack_print (bottom, top)
-    short *bottom;
-    short *top;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
-  for (/* Nothing. */; bottom <= top; ++bottom)
-    YYFPRINTF (stderr, " %d", *bottom);
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
 } while (0)
 
 
@@ -1300,45 +1601,45 @@ do {								\
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if defined (__STDC__) || defined (__cplusplus)
-static void
-yy_reduce_print (int yyrule)
-#else
 static void
-yy_reduce_print (yyrule)
-    int yyrule;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned int yylineno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %u), ",
-             yyrule - 1, yylineno);
-  /* Print the symbols being reduced, and their result.  */
-  for (yyi = yyprhs[yyrule]; 0 <= yyrhs[yyi]; yyi++)
-    YYFPRINTF (stderr, "%s ", yytname [yyrhs[yyi]]);
-  YYFPRINTF (stderr, "-> %s\n", yytname [yyr1[yyrule]]);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (Rule);		\
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
 } while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YYDSYMPRINT(Args)
-# define YYDSYMPRINTF(Title, Token, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -1346,362 +1647,230 @@ int yydebug;
    if the built-in stack extension method is used).
 
    Do not make this value too large; the results are undefined if
-   SIZE_MAX < YYSTACK_BYTES (YYMAXDEPTH)
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
    evaluated with infinite-precision integer arithmetic.  */
 
-#if YYMAXDEPTH == 0
-# undef YYMAXDEPTH
-#endif
-
 #ifndef YYMAXDEPTH
 # define YYMAXDEPTH 10000
 #endif
 
-
 
-#if YYERROR_VERBOSE
 
-# ifndef yystrlen
-#  if defined (__GLIBC__) && defined (_STRING_H)
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-static YYSIZE_T
-#   if defined (__STDC__) || defined (__cplusplus)
-yystrlen (const char *yystr)
-#   else
-yystrlen (yystr)
-     const char *yystr;
-#   endif
-{
-  register const char *yys = yystr;
 
-  while (*yys++ != '\0')
-    continue;
 
-  return yys - yystr - 1;
-}
-#  endif
-# endif
 
-# ifndef yystpcpy
-#  if defined (__GLIBC__) && defined (_STRING_H) && defined (_GNU_SOURCE)
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-#   if defined (__STDC__) || defined (__cplusplus)
-yystpcpy (char *yydest, const char *yysrc)
-#   else
-yystpcpy (yydest, yysrc)
-     char *yydest;
-     const char *yysrc;
-#   endif
-{
-  register char *yyd = yydest;
-  register const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-#endif /* !YYERROR_VERBOSE */
-
-
-
-#if YYDEBUG
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-#if defined (__STDC__) || defined (__cplusplus)
-static void
-yysymprint (FILE *yyoutput, int yytype, YYSTYPE *yyvaluep)
-#else
-static void
-yysymprint (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE *yyvaluep;
-#endif
-{
-  /* Pacify ``unused variable'' warnings.  */
-  (void) yyvaluep;
-
-  if (yytype < YYNTOKENS)
-    {
-      YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-# ifdef YYPRINT
-      YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# endif
-    }
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
-
-  switch (yytype)
-    {
-      default:
-        break;
-    }
-  YYFPRINTF (yyoutput, ")");
-}
-
-#endif /* ! YYDEBUG */
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-#if defined (__STDC__) || defined (__cplusplus)
 static void
-yydestruct (int yytype, YYSTYPE *yyvaluep)
-#else
-static void
-yydestruct (yytype, yyvaluep)
-    int yytype;
-    YYSTYPE *yyvaluep;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  /* Pacify ``unused variable'' warnings.  */
-  (void) yyvaluep;
-
-  switch (yytype)
-    {
-
-      default:
-        break;
-    }
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
-
 
-/* Prevent warnings from -Wmissing-prototypes.  */
 
-#ifdef YYPARSE_PARAM
-# if defined (__STDC__) || defined (__cplusplus)
-int yyparse (void *YYPARSE_PARAM);
-# else
-int yyparse ();
-# endif
-#else /* ! YYPARSE_PARAM */
-#if defined (__STDC__) || defined (__cplusplus)
-int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
-
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
 YYSTYPE yylval;
-
 /* Number of syntax errors so far.  */
 int yynerrs;
 
 
 
+
 /*----------.
 | yyparse.  |
 `----------*/
 
-#ifdef YYPARSE_PARAM
-# if defined (__STDC__) || defined (__cplusplus)
-int yyparse (void *YYPARSE_PARAM)
-# else
-int yyparse (YYPARSE_PARAM)
-  void *YYPARSE_PARAM;
-# endif
-#else /* ! YYPARSE_PARAM */
-#if defined (__STDC__) || defined (__cplusplus)
 int
 yyparse (void)
-#else
-int
-yyparse ()
-
-#endif
-#endif
 {
-  
-  register int yystate;
-  register int yyn;
-  int yyresult;
-  /* Number of tokens to shift before error messages enabled.  */
-/*   int yyerrstatus; */
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
-
-  /* Three stacks and their tools:
-     `yyss': related to states,
-     `yyvs': related to semantic values,
-     `yyls': related to locations.
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
 
-     Refer to the stacks thru separate pointers, to allow yyoverflow
-     to reallocate them elsewhere.  */
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
 
-  /* The state stack.  */
-  short	yyssa[YYINITDEPTH];
-  short *yyss = yyssa;
-  register short *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-  /* The semantic value stack.  */
-  YYSTYPE yyvsa[YYINITDEPTH];
-  YYSTYPE *yyvs = yyvsa;
-  register YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
-
-#define YYPOPSTACK   (yyvsp--, yyssp--)
-
-  YYSIZE_T yystacksize = YYINITDEPTH;
-
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
 
-  /* When reducing, the number of symbols on the RHS of the reduced
-     rule.  */
-  int yylen;
 
-  YYDPRINTF ((stderr, "Starting parse\n"));
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY;		/* Cause a token to be read.  */
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
 
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
+  YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yyssp = yyss;
-  yyvsp = yyvs;
+  yychar = YYEMPTY; /* Cause a token to be read.  */
 
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
-     have just been pushed. so pushing a state here evens the stacks.
-     */
+     have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack. Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	short *yyss1 = yyss;
-
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow ("parser stack overflow",
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyoverflowlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyoverflowlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	short *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyoverflowlab;
-	YYSTACK_RELOCATE (yyss);
-	YYSTACK_RELOCATE (yyvs);
-
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
-/* Do appropriate processing given the current state.  */
-/* Read a lookahead token if we need one and don't already have one.  */
-/* yyresume: */
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
 
   /* First try to decide what to do without reference to lookahead token.  */
-
   yyn = yypact[yystate];
-  if (yyn == YYPACT_NINF)
+  if (yypact_value_is_default (yyn))
     goto yydefault;
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
-      YYDSYMPRINTF ("Next token is", yytoken, &yylval, &yylloc);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
     }
 
   /* If the proper action on seeing token YYTOKEN is to reduce or to
@@ -1712,31 +1881,26 @@ yybackup:
   yyn = yytable[yyn];
   if (yyn <= 0)
     {
-      if (yyn == 0 || yyn == YYTABLE_NINF)
-	goto yyerrlab;
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
       yyn = -yyn;
       goto yyreduce;
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
-  /* Shift the lookahead token.  */
-  YYDPRINTF ((stderr, "Shifting token %s, ", yytname[yytoken]));
-
-  /* Discard the token being shifted unless it is eof.  */
-  if (yychar != YYEOF)
-    yychar = YYEMPTY;
-
-  *++yyvsp = yylval;
-
-
   /* Count tokens shifted since error; after three, turn off error
      status.  */
   if (yyerrstatus)
     yyerrstatus--;
 
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -1751,14 +1915,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -1771,1053 +1935,1011 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-    { erroneous = FALSE; }
+  case 2: /* lines: lines line  */
+                                { erroneous = FALSE; }
     break;
 
-  case 3:
-    { erroneous = FALSE; }
+  case 3: /* lines: %empty  */
+                                { erroneous = FALSE; }
     break;
 
-  case 4:
-    { clean_slate(); mod_fetch(); }
+  case 4: /* line: cmd ';'  */
+                                { clean_slate(); mod_fetch(); }
     break;
 
-  case 5:
-    { clean_slate(); yyerrok; }
+  case 5: /* line: error ';'  */
+                                { clean_slate(); yyerrok; }
     break;
 
-  case 7:
-    { preserve(); }
+  case 7: /* cmd: INFIX infixlist  */
+                                { preserve(); }
     break;
 
-  case 8:
-    { preserve(); }
+  case 8: /* cmd: INFIXR infixrlist  */
+                                { preserve(); }
     break;
 
-  case 10:
-    { type_syn(yyvsp[-2].deftype, yyvsp[0].type); }
+  case 10: /* cmd: TYPESYM newtype DEFEQ type  */
+                                { type_syn((yyvsp[-2].deftype), (yyvsp[0].type)); }
     break;
 
-  case 11:
-    { decl_type(yyvsp[-2].deftype, yyvsp[0].cons); }
+  case 11: /* cmd: DATA newtype DEFEQ constypelist  */
+                                { decl_type((yyvsp[-2].deftype), (yyvsp[0].cons)); }
     break;
 
-  case 12:
-    { mod_private(); }
+  case 12: /* cmd: PRIVATE  */
+                                { mod_private(); }
     break;
 
-  case 14:
-    {;}
+  case 14: /* cmd: simple_decl  */
+                                {;}
     break;
 
-  case 15:
-    { def_value(yyvsp[-2].expr, yyvsp[0].expr); }
+  case 15: /* cmd: VALOF expr IS exprbody  */
+                                { def_value((yyvsp[-2].expr), (yyvsp[0].expr)); }
     break;
 
-  case 16:
-    { def_value(yyvsp[-2].expr, yyvsp[0].expr); }
+  case 16: /* cmd: expr IS exprbody  */
+                                { def_value((yyvsp[-2].expr), (yyvsp[0].expr)); }
     break;
 
-  case 17:
-    { def_value(yyvsp[-2].expr, yyvsp[0].expr); }
+  case 17: /* cmd: expr DEFEQ exprbody  */
+                                { def_value((yyvsp[-2].expr), (yyvsp[0].expr)); }
     break;
 
-  case 18:
-    { eval_expr(yyvsp[0].expr); }
+  case 18: /* cmd: exprbody  */
+                                { eval_expr((yyvsp[0].expr)); }
     break;
 
-  case 19:
-    { wr_expr(yyvsp[0].expr, (const char *)0); }
+  case 19: /* cmd: WRITE expr  */
+                                { wr_expr((yyvsp[0].expr), nullptr); }
     break;
 
-  case 20:
-    { wr_expr(yyvsp[-2].expr, (const char *)(yyvsp[0].textval->t_start)); }
+  case 20: /* cmd: WRITE expr TO LITERAL  */
+                                { wr_expr((yyvsp[-2].expr), (const char *)((yyvsp[0].textval)->t_start)); }
     break;
 
-  case 21:
-    { display(); }
+  case 21: /* cmd: DISPLAY  */
+                                { display(); }
     break;
 
-  case 22:
-    { preserve(); }
+  case 22: /* cmd: RESET  */
+                                { reset_cafs(); }
     break;
 
-  case 23:
-    { mod_save(yyvsp[0].strval); }
+  case 23: /* cmd: USES uselist  */
+                                { preserve(); }
     break;
 
-  case 24:
-    { edit((String)0); }
+  case 24: /* cmd: SAVE ident  */
+                                { mod_save((yyvsp[0].strval)); }
     break;
 
-  case 25:
-    { edit(yyvsp[0].strval); }
+  case 25: /* cmd: EDIT  */
+                                { edit(nullptr); }
     break;
 
-  case 26:
-    { YYACCEPT; }
+  case 26: /* cmd: EDIT ident  */
+                                { edit((yyvsp[0].strval)); }
     break;
 
-  case 34:
-    {;}
+  case 27: /* cmd: EXIT  */
+                                { YYACCEPT; }
     break;
 
-  case 37:
-    { tv_declare(yyvsp[0].strval); }
+  case 35: /* idlist: ident  */
+                                {;}
     break;
 
-  case 38:
-    { op_declare(yyvsp[-2].strval, yyvsp[0].intval, ASSOC_LEFT); yyval.intval = yyvsp[0].intval; }
+  case 38: /* newtv: ident  */
+                                { tv_declare((yyvsp[0].strval)); }
     break;
 
-  case 39:
-    { op_declare(yyvsp[-2].strval, yyvsp[0].intval, ASSOC_LEFT); yyval.intval = yyvsp[0].intval; }
+  case 39: /* infixlist: IDENT ':' precedence  */
+                                { op_declare((yyvsp[-2].strval), (yyvsp[0].intval), ASSOC_LEFT); (yyval.intval) = (yyvsp[0].intval); }
     break;
 
-  case 40:
-    { op_declare(yyvsp[-2].strval, yyvsp[0].intval, ASSOC_RIGHT); yyval.intval = yyvsp[0].intval; }
+  case 40: /* infixlist: IDENT ',' infixlist  */
+                                { op_declare((yyvsp[-2].strval), (yyvsp[0].intval), ASSOC_LEFT); (yyval.intval) = (yyvsp[0].intval); }
     break;
 
-  case 41:
-    { op_declare(yyvsp[-2].strval, yyvsp[0].intval, ASSOC_RIGHT); yyval.intval = yyvsp[0].intval; }
+  case 41: /* infixrlist: IDENT ':' precedence  */
+                                { op_declare((yyvsp[-2].strval), (yyvsp[0].intval), ASSOC_RIGHT); (yyval.intval) = (yyvsp[0].intval); }
     break;
 
-  case 42:
-    { yyval.intval = (int)yyvsp[0].numval; }
+  case 42: /* infixrlist: IDENT ',' infixrlist  */
+                                { op_declare((yyvsp[-2].strval), (yyvsp[0].intval), ASSOC_RIGHT); (yyval.intval) = (yyvsp[0].intval); }
     break;
 
-  case 45:
-    { mod_use(yyvsp[0].strval); }
+  case 43: /* precedence: NUMBER  */
+                                { (yyval.intval) = (int)(yyvsp[0].numval); }
     break;
 
-  case 48:
-    { abstype(yyvsp[0].deftype); }
+  case 46: /* use: ident  */
+                                { mod_use((yyvsp[0].strval)); }
     break;
 
-  case 49:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, FALSE, yyvsp[0].typelist); }
+  case 49: /* abstype: newtype  */
+                                { abstype((yyvsp[0].deftype)); }
     break;
 
-  case 50:
-    { yyval.deftype = new_deftype(yyvsp[-3].strval, FALSE,
-						cons_type(yyvsp[-1].type, NULL)); }
+  case 50: /* newtype: ident tvargs  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), FALSE, (yyvsp[0].typelist)); }
     break;
 
-  case 51:
-    { yyval.deftype = new_deftype(yyvsp[-3].strval, TRUE, yyvsp[-1].typelist); }
+  case 51: /* newtype: ident '(' tv ')'  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-3].strval), FALSE,
+						cons_type((yyvsp[-1].type), nullptr)); }
     break;
 
-  case 52:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-					    cons_type(yyvsp[0].type,
-						(TypeList *)NULL))); }
+  case 52: /* newtype: ident '(' tvpair ')'  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-3].strval), TRUE, (yyvsp[-1].typelist)); }
     break;
 
-  case 53:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-					    cons_type(yyvsp[0].type,
-						(TypeList *)NULL))); }
+  case 53: /* newtype: tv LBINARY1 tv  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+					    cons_type((yyvsp[0].type),
+						nullptr))); }
     break;
 
-  case 54:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-					    cons_type(yyvsp[0].type,
-						(TypeList *)NULL))); }
+  case 54: /* newtype: tv RBINARY1 tv  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+					    cons_type((yyvsp[0].type),
+						nullptr))); }
     break;
 
-  case 55:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-					    cons_type(yyvsp[0].type,
-						(TypeList *)NULL))); }
+  case 55: /* newtype: tv LBINARY2 tv  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+					    cons_type((yyvsp[0].type),
+						nullptr))); }
     break;
 
-  case 56:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-					    cons_type(yyvsp[0].type,
-						(TypeList *)NULL))); }
+  case 56: /* newtype: tv RBINARY2 tv  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+					    cons_type((yyvsp[0].type),
+						nullptr))); }
     break;
 
-  case 57:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-					    cons_type(yyvsp[0].type,
-						(TypeList *)NULL))); }
+  case 57: /* newtype: tv LBINARY3 tv  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+					    cons_type((yyvsp[0].type),
+						nullptr))); }
     break;
 
-  case 58:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-					    cons_type(yyvsp[0].type,
-						(TypeList *)NULL))); }
+  case 58: /* newtype: tv RBINARY3 tv  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+					    cons_type((yyvsp[0].type),
+						nullptr))); }
     break;
 
-  case 59:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-					    cons_type(yyvsp[0].type,
-						(TypeList *)NULL))); }
+  case 59: /* newtype: tv LBINARY4 tv  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+					    cons_type((yyvsp[0].type),
+						nullptr))); }
     break;
 
-  case 60:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-					    cons_type(yyvsp[0].type,
-						(TypeList *)NULL))); }
+  case 60: /* newtype: tv RBINARY4 tv  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+					    cons_type((yyvsp[0].type),
+						nullptr))); }
     break;
 
-  case 61:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-					    cons_type(yyvsp[0].type,
-						(TypeList *)NULL))); }
+  case 61: /* newtype: tv LBINARY5 tv  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+					    cons_type((yyvsp[0].type),
+						nullptr))); }
     break;
 
-  case 62:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-					    cons_type(yyvsp[0].type,
-						(TypeList *)NULL))); }
+  case 62: /* newtype: tv RBINARY5 tv  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+					    cons_type((yyvsp[0].type),
+						nullptr))); }
     break;
 
-  case 63:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-					    cons_type(yyvsp[0].type,
-						(TypeList *)NULL))); }
+  case 63: /* newtype: tv LBINARY6 tv  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+					    cons_type((yyvsp[0].type),
+						nullptr))); }
     break;
 
-  case 64:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-					    cons_type(yyvsp[0].type,
-						(TypeList *)NULL))); }
+  case 64: /* newtype: tv RBINARY6 tv  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+					    cons_type((yyvsp[0].type),
+						nullptr))); }
     break;
 
-  case 65:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-					    cons_type(yyvsp[0].type,
-						(TypeList *)NULL))); }
+  case 65: /* newtype: tv LBINARY7 tv  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+					    cons_type((yyvsp[0].type),
+						nullptr))); }
     break;
 
-  case 66:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-					    cons_type(yyvsp[0].type,
-						(TypeList *)NULL))); }
+  case 66: /* newtype: tv RBINARY7 tv  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+					    cons_type((yyvsp[0].type),
+						nullptr))); }
     break;
 
-  case 67:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-					    cons_type(yyvsp[0].type,
-						(TypeList *)NULL))); }
+  case 67: /* newtype: tv LBINARY8 tv  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+					    cons_type((yyvsp[0].type),
+						nullptr))); }
     break;
 
-  case 68:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-					    cons_type(yyvsp[0].type,
-						(TypeList *)NULL))); }
+  case 68: /* newtype: tv RBINARY8 tv  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+					    cons_type((yyvsp[0].type),
+						nullptr))); }
     break;
 
-  case 69:
-    { yyval.deftype = new_deftype(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-					    cons_type(yyvsp[0].type,
-						(TypeList *)NULL))); }
+  case 69: /* newtype: tv LBINARY9 tv  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+					    cons_type((yyvsp[0].type),
+						nullptr))); }
     break;
 
-  case 70:
-    { yyval.typelist = NULL; }
+  case 70: /* newtype: tv RBINARY9 tv  */
+                                { (yyval.deftype) = new_deftype((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+					    cons_type((yyvsp[0].type),
+						nullptr))); }
     break;
 
-  case 71:
-    { yyval.typelist = cons_type(yyvsp[-1].type, yyvsp[0].typelist); }
+  case 71: /* tvargs: %empty  */
+                                { (yyval.typelist) = nullptr; }
     break;
 
-  case 72:
-    { yyval.typelist = cons_type(yyvsp[0].type, (TypeList *)NULL); }
+  case 72: /* tvargs: tv tvargs  */
+                                { (yyval.typelist) = cons_type((yyvsp[-1].type), (yyvsp[0].typelist)); }
     break;
 
-  case 73:
-    { yyval.typelist = yyvsp[0].typelist; }
+  case 73: /* tvlist: tv  */
+                                { (yyval.typelist) = cons_type((yyvsp[0].type), nullptr); }
     break;
 
-  case 74:
-    { yyval.typelist = cons_type(yyvsp[-2].type, yyvsp[0].typelist); }
+  case 74: /* tvlist: tvpair  */
+                                { (yyval.typelist) = (yyvsp[0].typelist); }
     break;
 
-  case 75:
-    { yyval.type = new_tv(yyvsp[0].strval); }
+  case 75: /* tvpair: tv ',' tvlist  */
+                                { (yyval.typelist) = cons_type((yyvsp[-2].type), (yyvsp[0].typelist)); }
     break;
 
-  case 76:
-    { yyval.cons = alt_cons(yyvsp[0].cons, (Cons *)NULL); }
+  case 76: /* tv: ident  */
+                                { (yyval.type) = new_tv((yyvsp[0].strval)); }
     break;
 
-  case 77:
-    { yyval.cons = alt_cons(yyvsp[-2].cons, yyvsp[0].cons); }
+  case 77: /* constypelist: constype  */
+                                { (yyval.cons) = alt_cons((yyvsp[0].cons), nullptr); }
     break;
 
-  case 78:
-    { yyval.cons = constructor(yyvsp[-1].strval, FALSE, yyvsp[0].typelist); }
+  case 78: /* constypelist: constype OR constypelist  */
+                                { (yyval.cons) = alt_cons((yyvsp[-2].cons), (yyvsp[0].cons)); }
     break;
 
-  case 79:
-    { yyval.cons = constructor(yyvsp[-3].strval, TRUE, yyvsp[-1].typelist); }
+  case 79: /* constype: ident typeargs  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), FALSE, (yyvsp[0].typelist)); }
     break;
 
-  case 80:
-    { yyval.cons = constructor(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 80: /* constype: ident '(' typepair ')'  */
+                                { (yyval.cons) = constructor((yyvsp[-3].strval), TRUE, (yyvsp[-1].typelist)); }
     break;
 
-  case 81:
-    { yyval.cons = constructor(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 81: /* constype: type LBINARY1 type  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 82:
-    { yyval.cons = constructor(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 82: /* constype: type RBINARY1 type  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 83:
-    { yyval.cons = constructor(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 83: /* constype: type LBINARY2 type  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 84:
-    { yyval.cons = constructor(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 84: /* constype: type RBINARY2 type  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 85:
-    { yyval.cons = constructor(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 85: /* constype: type LBINARY3 type  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 86:
-    { yyval.cons = constructor(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 86: /* constype: type RBINARY3 type  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 87:
-    { yyval.cons = constructor(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 87: /* constype: type LBINARY4 type  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 88:
-    { yyval.cons = constructor(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 88: /* constype: type RBINARY4 type  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 89:
-    { yyval.cons = constructor(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 89: /* constype: type LBINARY5 type  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 90:
-    { yyval.cons = constructor(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 90: /* constype: type RBINARY5 type  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 91:
-    { yyval.cons = constructor(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 91: /* constype: type LBINARY6 type  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 92:
-    { yyval.cons = constructor(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 92: /* constype: type RBINARY6 type  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 93:
-    { yyval.cons = constructor(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 93: /* constype: type LBINARY7 type  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 94:
-    { yyval.cons = constructor(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 94: /* constype: type RBINARY7 type  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 95:
-    { yyval.cons = constructor(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 95: /* constype: type LBINARY8 type  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 96:
-    { yyval.cons = constructor(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 96: /* constype: type RBINARY8 type  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 97:
-    { yyval.cons = constructor(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 97: /* constype: type LBINARY9 type  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 98:
-    { yyval.type = new_type(yyvsp[-1].strval, FALSE, yyvsp[0].typelist); }
+  case 98: /* constype: type RBINARY9 type  */
+                                { (yyval.cons) = constructor((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 99:
-    { yyval.type = new_type(yyvsp[-3].strval, TRUE, yyvsp[-1].typelist); }
+  case 99: /* type: ident typeargs  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), FALSE, (yyvsp[0].typelist)); }
     break;
 
-  case 100:
-    { yyval.type = new_type(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 100: /* type: ident '(' typepair ')'  */
+                                { (yyval.type) = new_type((yyvsp[-3].strval), TRUE, (yyvsp[-1].typelist)); }
     break;
 
-  case 101:
-    { yyval.type = new_type(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 101: /* type: type LBINARY1 type  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 102:
-    { yyval.type = new_type(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 102: /* type: type RBINARY1 type  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 103:
-    { yyval.type = new_type(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 103: /* type: type LBINARY2 type  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 104:
-    { yyval.type = new_type(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 104: /* type: type RBINARY2 type  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 105:
-    { yyval.type = new_type(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 105: /* type: type LBINARY3 type  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 106:
-    { yyval.type = new_type(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 106: /* type: type RBINARY3 type  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 107:
-    { yyval.type = new_type(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 107: /* type: type LBINARY4 type  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 108:
-    { yyval.type = new_type(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 108: /* type: type RBINARY4 type  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 109:
-    { yyval.type = new_type(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 109: /* type: type LBINARY5 type  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 110:
-    { yyval.type = new_type(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 110: /* type: type RBINARY5 type  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 111:
-    { yyval.type = new_type(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 111: /* type: type LBINARY6 type  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 112:
-    { yyval.type = new_type(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 112: /* type: type RBINARY6 type  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 113:
-    { yyval.type = new_type(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 113: /* type: type LBINARY7 type  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 114:
-    { yyval.type = new_type(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 114: /* type: type RBINARY7 type  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 115:
-    { yyval.type = new_type(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 115: /* type: type LBINARY8 type  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 116:
-    { yyval.type = new_type(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 116: /* type: type RBINARY8 type  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 117:
-    { yyval.type = new_type(yyvsp[-1].strval, TRUE,
-					cons_type(yyvsp[-2].type,
-						cons_type(yyvsp[0].type,
-							(TypeList *)NULL))); }
+  case 117: /* type: type LBINARY9 type  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 118:
-    { yyval.type = mu_type(yyvsp[0].type); }
+  case 118: /* type: type RBINARY9 type  */
+                                { (yyval.type) = new_type((yyvsp[-1].strval), TRUE,
+					cons_type((yyvsp[-2].type),
+						cons_type((yyvsp[0].type),
+							nullptr))); }
     break;
 
-  case 119:
-    { yyval.type = yyvsp[-1].type; }
+  case 119: /* type: MU mu_tv GIVES type  */
+                                { (yyval.type) = mu_type((yyvsp[0].type)); }
     break;
 
-  case 120:
-    { yyval.typelist = (TypeList *)NULL; }
+  case 120: /* type: '(' type ')'  */
+                                { (yyval.type) = (yyvsp[-1].type); }
     break;
 
-  case 121:
-    { yyval.typelist = cons_type(yyvsp[-1].type, yyvsp[0].typelist); }
+  case 121: /* typeargs: %empty  */
+                                { (yyval.typelist) = nullptr; }
     break;
 
-  case 122:
-    { yyval.type = new_type(yyvsp[0].strval, FALSE,
-						(TypeList *)NULL); }
+  case 122: /* typeargs: typearg typeargs  */
+                                { (yyval.typelist) = cons_type((yyvsp[-1].type), (yyvsp[0].typelist)); }
     break;
 
-  case 123:
-    { yyval.type = yyvsp[-1].type; }
+  case 123: /* typearg: ident  */
+                                { (yyval.type) = new_type((yyvsp[0].strval), FALSE,
+						nullptr); }
     break;
 
-  case 124:
-    { yyval.typelist = cons_type(yyvsp[0].type, (TypeList *)NULL); }
+  case 124: /* typearg: '(' type ')'  */
+                                { (yyval.type) = (yyvsp[-1].type); }
     break;
 
-  case 125:
-    { yyval.typelist = yyvsp[0].typelist; }
+  case 125: /* typelist: type  */
+                                { (yyval.typelist) = cons_type((yyvsp[0].type), nullptr); }
     break;
 
-  case 126:
-    { yyval.typelist = cons_type(yyvsp[-2].type, yyvsp[0].typelist); }
+  case 126: /* typelist: typepair  */
+                                { (yyval.typelist) = (yyvsp[0].typelist); }
     break;
 
-  case 127:
-    { enter_mu_tv(yyvsp[0].strval); }
+  case 127: /* typepair: type ',' typelist  */
+                                { (yyval.typelist) = cons_type((yyvsp[-2].type), (yyvsp[0].typelist)); }
     break;
 
-  case 128:
-    { yyval.qtype = yyvsp[0].qtype; }
+  case 128: /* mu_tv: ident  */
+                                { enter_mu_tv((yyvsp[0].strval)); }
     break;
 
-  case 129:
-    { decl_value(yyvsp[-2].strval, yyvsp[0].qtype); yyval.qtype = yyvsp[0].qtype; }
+  case 129: /* decl: simple_decl  */
+                                { (yyval.qtype) = (yyvsp[0].qtype); }
     break;
 
-  case 130:
-    { decl_value(yyvsp[-2].strval, yyvsp[0].qtype); yyval.qtype = yyvsp[0].qtype; }
+  case 130: /* decl: name ',' decl  */
+                                { decl_value((yyvsp[-2].strval), (yyvsp[0].qtype)); (yyval.qtype) = (yyvsp[0].qtype); }
     break;
 
-  case 131:
-    { yyval.qtype = qualified_type(yyvsp[0].type); }
+  case 131: /* simple_decl: name ':' q_type  */
+                                { decl_value((yyvsp[-2].strval), (yyvsp[0].qtype)); (yyval.qtype) = (yyvsp[0].qtype); }
     break;
 
-  case 132:
-    { start_dec_type(); }
+  case 132: /* q_type: start_dec type  */
+                                { (yyval.qtype) = qualified_type((yyvsp[0].type)); }
     break;
 
-  case 133:
-    { yyval.expr = id_expr(yyvsp[0].strval); }
+  case 133: /* start_dec: %empty  */
+                                { start_dec_type(); }
     break;
 
-  case 134:
-    { yyval.expr = pair_expr(yyvsp[-2].expr, yyvsp[0].expr); }
+  case 134: /* tuple: ident  */
+                                { (yyval.expr) = id_expr((yyvsp[0].strval)); }
     break;
 
-  case 135:
-    { yyval.expr = yyvsp[-1].expr; }
+  case 135: /* tuple: tuple ',' tuple  */
+                                { (yyval.expr) = pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)); }
     break;
 
-  case 136:
-    { yyval.expr = id_expr(yyvsp[0].strval); }
+  case 136: /* tuple: '(' tuple ')'  */
+                                { (yyval.expr) = (yyvsp[-1].expr); }
     break;
 
-  case 137:
-    { yyval.expr = num_expr(yyvsp[0].numval); }
+  case 137: /* expr: ident  */
+                                { (yyval.expr) = id_expr((yyvsp[0].strval)); }
     break;
 
-  case 138:
-    { yyval.expr = text_expr(yyvsp[0].textval->t_start, yyvsp[0].textval->t_length); }
+  case 138: /* expr: NUMBER  */
+                                { (yyval.expr) = num_expr((yyvsp[0].numval)); }
     break;
 
-  case 139:
-    { yyval.expr = char_expr(yyvsp[0].charval); }
+  case 139: /* expr: LITERAL  */
+                                { (yyval.expr) = text_expr((yyvsp[0].textval)->t_start, (yyvsp[0].textval)->t_length); }
     break;
 
-  case 140:
-    { yyval.expr = presection(yyvsp[-1].strval, yyvsp[-2].expr); }
+  case 140: /* expr: CHAR  */
+                                { (yyval.expr) = char_expr((yyvsp[0].charval)); }
     break;
 
-  case 141:
-    { yyval.expr = postsection(yyvsp[-2].strval, yyvsp[-1].expr); }
+  case 141: /* expr: '(' expr binop ')'  */
+                                { (yyval.expr) = presection((yyvsp[-1].strval), (yyvsp[-2].expr)); }
     break;
 
-  case 142:
-    { yyval.expr = yyvsp[-1].expr; }
+  case 142: /* expr: '(' binop expr ')'  */
+                                { (yyval.expr) = postsection((yyvsp[-2].strval), (yyvsp[-1].expr)); }
     break;
 
-  case 143:
-    { yyval.expr = yyvsp[-1].expr; }
+  case 143: /* expr: '(' exprbody ')'  */
+                                { (yyval.expr) = (yyvsp[-1].expr); }
     break;
 
-  case 144:
-    { yyval.expr = e_nil; }
+  case 144: /* expr: '[' exprlist ']'  */
+                                { (yyval.expr) = (yyvsp[-1].expr); }
     break;
 
-  case 145:
-    { yyval.expr = apply_expr(yyvsp[-1].expr, yyvsp[0].expr); }
+  case 145: /* expr: '[' ']'  */
+                                { (yyval.expr) = e_nil; }
     break;
 
-  case 146:
-    { yyval.expr = apply_expr(id_expr(yyvsp[-1].strval),
-						pair_expr(yyvsp[-2].expr, yyvsp[0].expr));
+  case 146: /* expr: expr expr  */
+                                { (yyval.expr) = apply_expr((yyvsp[-1].expr), (yyvsp[0].expr)); }
+    break;
+
+  case 147: /* expr: expr LBINARY1 expr  */
+                                { (yyval.expr) = apply_expr(id_expr((yyvsp[-1].strval)),
+						pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)));
 				}
     break;
 
-  case 147:
-    { yyval.expr = apply_expr(id_expr(yyvsp[-1].strval),
-						pair_expr(yyvsp[-2].expr, yyvsp[0].expr));
+  case 148: /* expr: expr RBINARY1 expr  */
+                                { (yyval.expr) = apply_expr(id_expr((yyvsp[-1].strval)),
+						pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)));
 				}
     break;
 
-  case 148:
-    { yyval.expr = apply_expr(id_expr(yyvsp[-1].strval),
-						pair_expr(yyvsp[-2].expr, yyvsp[0].expr));
+  case 149: /* expr: expr LBINARY2 expr  */
+                                { (yyval.expr) = apply_expr(id_expr((yyvsp[-1].strval)),
+						pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)));
 				}
     break;
 
-  case 149:
-    { yyval.expr = apply_expr(id_expr(yyvsp[-1].strval),
-						pair_expr(yyvsp[-2].expr, yyvsp[0].expr));
+  case 150: /* expr: expr RBINARY2 expr  */
+                                { (yyval.expr) = apply_expr(id_expr((yyvsp[-1].strval)),
+						pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)));
 				}
     break;
 
-  case 150:
-    { yyval.expr = apply_expr(id_expr(yyvsp[-1].strval),
-						pair_expr(yyvsp[-2].expr, yyvsp[0].expr));
+  case 151: /* expr: expr LBINARY3 expr  */
+                                { (yyval.expr) = apply_expr(id_expr((yyvsp[-1].strval)),
+						pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)));
 				}
     break;
 
-  case 151:
-    { yyval.expr = apply_expr(id_expr(yyvsp[-1].strval),
-						pair_expr(yyvsp[-2].expr, yyvsp[0].expr));
+  case 152: /* expr: expr RBINARY3 expr  */
+                                { (yyval.expr) = apply_expr(id_expr((yyvsp[-1].strval)),
+						pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)));
 				}
     break;
 
-  case 152:
-    { yyval.expr = apply_expr(id_expr(yyvsp[-1].strval),
-						pair_expr(yyvsp[-2].expr, yyvsp[0].expr));
+  case 153: /* expr: expr LBINARY4 expr  */
+                                { (yyval.expr) = apply_expr(id_expr((yyvsp[-1].strval)),
+						pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)));
 				}
     break;
 
-  case 153:
-    { yyval.expr = apply_expr(id_expr(yyvsp[-1].strval),
-						pair_expr(yyvsp[-2].expr, yyvsp[0].expr));
+  case 154: /* expr: expr RBINARY4 expr  */
+                                { (yyval.expr) = apply_expr(id_expr((yyvsp[-1].strval)),
+						pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)));
 				}
     break;
 
-  case 154:
-    { yyval.expr = apply_expr(id_expr(yyvsp[-1].strval),
-						pair_expr(yyvsp[-2].expr, yyvsp[0].expr));
+  case 155: /* expr: expr LBINARY5 expr  */
+                                { (yyval.expr) = apply_expr(id_expr((yyvsp[-1].strval)),
+						pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)));
 				}
     break;
 
-  case 155:
-    { yyval.expr = apply_expr(id_expr(yyvsp[-1].strval),
-						pair_expr(yyvsp[-2].expr, yyvsp[0].expr));
+  case 156: /* expr: expr RBINARY5 expr  */
+                                { (yyval.expr) = apply_expr(id_expr((yyvsp[-1].strval)),
+						pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)));
 				}
     break;
 
-  case 156:
-    { yyval.expr = apply_expr(id_expr(yyvsp[-1].strval),
-						pair_expr(yyvsp[-2].expr, yyvsp[0].expr));
+  case 157: /* expr: expr LBINARY6 expr  */
+                                { (yyval.expr) = apply_expr(id_expr((yyvsp[-1].strval)),
+						pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)));
 				}
     break;
 
-  case 157:
-    { yyval.expr = apply_expr(id_expr(yyvsp[-1].strval),
-						pair_expr(yyvsp[-2].expr, yyvsp[0].expr));
+  case 158: /* expr: expr RBINARY6 expr  */
+                                { (yyval.expr) = apply_expr(id_expr((yyvsp[-1].strval)),
+						pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)));
 				}
     break;
 
-  case 158:
-    { yyval.expr = apply_expr(id_expr(yyvsp[-1].strval),
-						pair_expr(yyvsp[-2].expr, yyvsp[0].expr));
+  case 159: /* expr: expr LBINARY7 expr  */
+                                { (yyval.expr) = apply_expr(id_expr((yyvsp[-1].strval)),
+						pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)));
 				}
     break;
 
-  case 159:
-    { yyval.expr = apply_expr(id_expr(yyvsp[-1].strval),
-						pair_expr(yyvsp[-2].expr, yyvsp[0].expr));
+  case 160: /* expr: expr RBINARY7 expr  */
+                                { (yyval.expr) = apply_expr(id_expr((yyvsp[-1].strval)),
+						pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)));
 				}
     break;
 
-  case 160:
-    { yyval.expr = apply_expr(id_expr(yyvsp[-1].strval),
-						pair_expr(yyvsp[-2].expr, yyvsp[0].expr));
+  case 161: /* expr: expr LBINARY8 expr  */
+                                { (yyval.expr) = apply_expr(id_expr((yyvsp[-1].strval)),
+						pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)));
 				}
     break;
 
-  case 161:
-    { yyval.expr = apply_expr(id_expr(yyvsp[-1].strval),
-						pair_expr(yyvsp[-2].expr, yyvsp[0].expr));
+  case 162: /* expr: expr RBINARY8 expr  */
+                                { (yyval.expr) = apply_expr(id_expr((yyvsp[-1].strval)),
+						pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)));
 				}
     break;
 
-  case 162:
-    { yyval.expr = apply_expr(id_expr(yyvsp[-1].strval),
-						pair_expr(yyvsp[-2].expr, yyvsp[0].expr));
+  case 163: /* expr: expr LBINARY9 expr  */
+                                { (yyval.expr) = apply_expr(id_expr((yyvsp[-1].strval)),
+						pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)));
 				}
     break;
 
-  case 163:
-    { yyval.expr = apply_expr(id_expr(yyvsp[-1].strval),
-						pair_expr(yyvsp[-2].expr, yyvsp[0].expr));
+  case 164: /* expr: expr RBINARY9 expr  */
+                                { (yyval.expr) = apply_expr(id_expr((yyvsp[-1].strval)),
+						pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)));
 				}
     break;
 
-  case 164:
-    { yyval.expr = func_expr(yyvsp[-1].branch); }
+  case 165: /* expr: LAMBDA rulelist optend  */
+                                { (yyval.expr) = func_expr((yyvsp[-1].branch)); }
     break;
 
-  case 165:
-    { yyval.expr = ite_expr(yyvsp[-4].expr, yyvsp[-2].expr, yyvsp[0].expr); }
+  case 166: /* expr: IF expr THEN exprbody ELSE expr  */
+                                { (yyval.expr) = ite_expr((yyvsp[-4].expr), (yyvsp[-2].expr), (yyvsp[0].expr)); }
     break;
 
-  case 166:
-    { yyval.expr = let_expr(yyvsp[-4].expr, yyvsp[-2].expr, yyvsp[0].expr, FALSE); }
+  case 167: /* expr: LET exprbody DEFEQ exprbody IN expr  */
+                                { (yyval.expr) = let_expr((yyvsp[-4].expr), (yyvsp[-2].expr), (yyvsp[0].expr), FALSE); }
     break;
 
-  case 167:
-    { yyval.expr = let_expr(yyvsp[-4].expr, yyvsp[-2].expr, yyvsp[0].expr, TRUE); }
+  case 168: /* expr: LETREC tuple DEFEQ exprbody IN expr  */
+                                { (yyval.expr) = let_expr((yyvsp[-4].expr), (yyvsp[-2].expr), (yyvsp[0].expr), TRUE); }
     break;
 
-  case 168:
-    { yyval.expr = where_expr(yyvsp[-4].expr, yyvsp[-2].expr, yyvsp[0].expr, FALSE); }
+  case 169: /* expr: expr WHERE exprbody DEFEQ expr  */
+                                { (yyval.expr) = where_expr((yyvsp[-4].expr), (yyvsp[-2].expr), (yyvsp[0].expr), FALSE); }
     break;
 
-  case 169:
-    { yyval.expr = where_expr(yyvsp[-4].expr, yyvsp[-2].expr, yyvsp[0].expr, TRUE); }
+  case 170: /* expr: expr WHEREREC tuple DEFEQ expr  */
+                                { (yyval.expr) = where_expr((yyvsp[-4].expr), (yyvsp[-2].expr), (yyvsp[0].expr), TRUE); }
     break;
 
-  case 170:
-    { yyval.expr = mu_expr(yyvsp[-2].expr, yyvsp[0].expr); }
+  case 171: /* expr: MU tuple GIVES expr  */
+                                { (yyval.expr) = mu_expr((yyvsp[-2].expr), (yyvsp[0].expr)); }
     break;
 
-  case 171:
-    { yyval.expr = yyvsp[0].expr; }
+  case 172: /* exprbody: expr  */
+                                { (yyval.expr) = (yyvsp[0].expr); }
     break;
 
-  case 172:
-    { yyval.expr = pair_expr(yyvsp[-2].expr, yyvsp[0].expr); }
+  case 173: /* exprbody: expr ',' exprbody  */
+                                { (yyval.expr) = pair_expr((yyvsp[-2].expr), (yyvsp[0].expr)); }
     break;
 
-  case 173:
-    { yyval.expr = apply_expr(e_cons,
-						  pair_expr(yyvsp[0].expr, e_nil));
+  case 174: /* exprlist: expr  */
+                                { (yyval.expr) = apply_expr(e_cons,
+						  pair_expr((yyvsp[0].expr), e_nil));
 				}
     break;
 
-  case 174:
-    { yyval.expr = apply_expr(e_cons, pair_expr(yyvsp[-2].expr, yyvsp[0].expr)); }
+  case 175: /* exprlist: expr ',' exprlist  */
+                                { (yyval.expr) = apply_expr(e_cons, pair_expr((yyvsp[-2].expr), (yyvsp[0].expr))); }
     break;
 
-  case 175:
-    { yyval.branch = new_branch(yyvsp[-2].expr, yyvsp[0].expr, (Branch *)0); }
+  case 176: /* rulelist: formals GIVES expr  */
+                                { (yyval.branch) = new_branch((yyvsp[-2].expr), (yyvsp[0].expr), nullptr); }
     break;
 
-  case 176:
-    { yyval.branch = new_branch(yyvsp[-4].expr, yyvsp[-2].expr, yyvsp[0].branch); }
+  case 177: /* rulelist: formals GIVES expr '|' rulelist  */
+                                { (yyval.branch) = new_branch((yyvsp[-4].expr), (yyvsp[-2].expr), (yyvsp[0].branch)); }
     break;
 
-  case 177:
-    { yyval.expr = apply_expr((Expr *)0, yyvsp[0].expr); }
+  case 178: /* formals: exprbody  */
+                                { (yyval.expr) = apply_expr(nullptr, (yyvsp[0].expr)); }
     break;
 
-  case 180:
-    { yyval.strval = yyvsp[0].strval; }
+  case 181: /* name: ident  */
+                                { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 181:
-    { yyval.strval = yyvsp[0].strval; }
+  case 182: /* name: binop  */
+                                { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 182:
-    { yyval.strval = yyvsp[0].strval; }
+  case 183: /* ident: IDENT  */
+                                { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 183:
-    { yyval.strval = yyvsp[-1].strval; }
+  case 184: /* ident: '(' binop ')'  */
+                                { (yyval.strval) = (yyvsp[-1].strval); }
     break;
 
-  case 184:
-    { yyval.strval = yyvsp[0].strval; }
+  case 185: /* ident: NONOP binop  */
+                                { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 185:
-    { yyval.strval = yyvsp[0].strval; }
+  case 186: /* binop: LBINARY1  */
+                                        { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 186:
-    { yyval.strval = yyvsp[0].strval; }
+  case 187: /* binop: RBINARY1  */
+                                        { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 187:
-    { yyval.strval = yyvsp[0].strval; }
+  case 188: /* binop: LBINARY2  */
+                                        { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 188:
-    { yyval.strval = yyvsp[0].strval; }
+  case 189: /* binop: RBINARY2  */
+                                        { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 189:
-    { yyval.strval = yyvsp[0].strval; }
+  case 190: /* binop: LBINARY3  */
+                                        { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 190:
-    { yyval.strval = yyvsp[0].strval; }
+  case 191: /* binop: RBINARY3  */
+                                        { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 191:
-    { yyval.strval = yyvsp[0].strval; }
+  case 192: /* binop: LBINARY4  */
+                                        { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 192:
-    { yyval.strval = yyvsp[0].strval; }
+  case 193: /* binop: RBINARY4  */
+                                        { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 193:
-    { yyval.strval = yyvsp[0].strval; }
+  case 194: /* binop: LBINARY5  */
+                                        { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 194:
-    { yyval.strval = yyvsp[0].strval; }
+  case 195: /* binop: RBINARY5  */
+                                        { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 195:
-    { yyval.strval = yyvsp[0].strval; }
+  case 196: /* binop: LBINARY6  */
+                                        { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 196:
-    { yyval.strval = yyvsp[0].strval; }
+  case 197: /* binop: RBINARY6  */
+                                        { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 197:
-    { yyval.strval = yyvsp[0].strval; }
+  case 198: /* binop: LBINARY7  */
+                                        { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 198:
-    { yyval.strval = yyvsp[0].strval; }
+  case 199: /* binop: RBINARY7  */
+                                        { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 199:
-    { yyval.strval = yyvsp[0].strval; }
+  case 200: /* binop: LBINARY8  */
+                                        { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 200:
-    { yyval.strval = yyvsp[0].strval; }
+  case 201: /* binop: RBINARY8  */
+                                        { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 201:
-    { yyval.strval = yyvsp[0].strval; }
+  case 202: /* binop: LBINARY9  */
+                                        { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
-  case 202:
-    { yyval.strval = yyvsp[0].strval; }
+  case 203: /* binop: RBINARY9  */
+                                        { (yyval.strval) = (yyvsp[0].strval); }
     break;
 
 
-    }
-
-/* Line 999 of yacc.c.  */
-
-  yyvsp -= yylen;
-  yyssp -= yylen;
-
 
-  YY_STACK_PRINT (yyss, yyssp);
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
 
   *++yyvsp = yyval;
 
-
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if YYERROR_VERBOSE
-      yyn = yypact[yystate];
-
-      if (YYPACT_NINF < yyn && yyn < YYLAST)
-	{
-	  YYSIZE_T yysize = 0;
-	  int yytype = YYTRANSLATE (yychar);
-	  char *yymsg;
-	  int yyx, yycount;
-
-	  yycount = 0;
-	  /* Start YYX at -YYN if negative to avoid negative indexes in
-	     YYCHECK.  */
-	  for (yyx = yyn < 0 ? -yyn : 0;
-	       yyx < (int) (sizeof (yytname) / sizeof (char *)); yyx++)
-	    if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR)
-	      yysize += yystrlen (yytname[yyx]) + 15, yycount++;
-	  yysize += yystrlen ("syntax error, unexpected ") + 1;
-	  yysize += yystrlen (yytname[yytype]);
-	  yymsg = (char *) YYSTACK_ALLOC (yysize);
-	  if (yymsg != 0)
-	    {
-	      char *yyp = yystpcpy (yymsg, "syntax error, unexpected ");
-	      yyp = yystpcpy (yyp, yytname[yytype]);
-
-	      if (yycount < 5)
-		{
-		  yycount = 0;
-		  for (yyx = yyn < 0 ? -yyn : 0;
-		       yyx < (int) (sizeof (yytname) / sizeof (char *));
-		       yyx++)
-		    if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR)
-		      {
-			const char *yyq = ! yycount ? ", expecting " : " or ";
-			yyp = yystpcpy (yyp, yyq);
-			yyp = yystpcpy (yyp, yytname[yyx]);
-			yycount++;
-		      }
-		}
-	      yyerror (yymsg);
-	      YYSTACK_FREE (yymsg);
-	    }
-	  else
-	    yyerror ("syntax error; also virtual memory exhausted");
-	}
-      else
-#endif /* YYERROR_VERBOSE */
-	yyerror ("syntax error");
+      yyerror (YY_("syntax error"));
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
-	 error, discard it.  */
+         error, discard it.  */
 
-      /* Return failure if at end of input.  */
-      if (yychar == YYEOF)
+      if (yychar <= YYEOF)
         {
-	  /* Pop the error token.  */
-          YYPOPSTACK;
-	  /* Pop the rest of the stack.  */
-	  while (yyss < yyssp)
-	    {
-	      YYDSYMPRINTF ("Error: popping", yystos[*yyssp], yyvsp, yylsp);
-	      yydestruct (yystos[*yyssp], yyvsp);
-	      YYPOPSTACK;
-	    }
-	  YYABORT;
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
         }
-
-      YYDSYMPRINTF ("Error: discarding", yytoken, &yylval, &yylloc);
-      yydestruct (yytoken, &yylval);
-      yychar = YYEMPTY;
-
     }
 
   /* Else will try to reuse lookahead token after shifting the error
@@ -2825,46 +2947,66 @@ yyerrlab:
   goto yyerrlab1;
 
 
-/*----------------------------------------------------.
-| yyerrlab1 -- error raised explicitly by an action.  |
-`----------------------------------------------------*/
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
-      if (yyn != YYPACT_NINF)
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
-      YYDSYMPRINTF ("Error: popping", yystos[*yyssp], yyvsp, yylsp);
-      yydestruct (yystos[yystate], yyvsp);
-      yyvsp--;
-      yystate = *--yyssp;
 
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
-  YYDPRINTF ((stderr, "Shifting error token, "));
-
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
   yystate = yyn;
   goto yynewstate;
 
@@ -2874,33 +3016,54 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#ifndef yyoverflow
-/*----------------------------------------------.
-| yyoverflowlab -- parser overflow comes here.  |
-`----------------------------------------------*/
-yyoverflowlab:
-  yyerror ("parser stack overflow");
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
+
   return yyresult;
 }
 
 
-
-
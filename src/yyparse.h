@@ -1,12 +1,14 @@
-/* A Bison parser, made by GNU Bison 1.875a.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* Skeleton parser for Yacc-like parsing with Bison,
-   Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003 Free Software Foundation, Inc.
+/* Bison interface for Yacc-like parsers in C
 
-   This program is free software; you can redistribute it and/or modify
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
 
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
@@ -14,85 +16,115 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 59 Temple Place - Suite 330,
-   Boston, MA 02111-1307, USA.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
 
-/* As a special exception, when this file is copied by Bison into a
-   Bison output file, you may use that output file without restriction.
-   This special exception was added by the Free Software Foundation
-   in version 1.24 of Bison.  */
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
 
-/* Tokens.  */
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_Y_TAB_H_INCLUDED
+# define YY_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     TYPEVAR = 258,
-     ABSTYPE = 259,
-     DATA = 260,
-     TYPESYM = 261,
-     DEC = 262,
-     INFIX = 263,
-     INFIXR = 264,
-     USES = 265,
-     PRIVATE = 266,
-     DISPLAY = 267,
-     SAVE = 268,
-     WRITE = 269,
-     TO = 270,
-     EXIT = 271,
-     EDIT = 272,
-     DEFEQ = 273,
-     OR = 274,
-     VALOF = 275,
-     IS = 276,
-     GIVES = 277,
-     THEN = 278,
-     FORALL = 279,
-     MODSYM = 280,
-     PUBCONST = 281,
-     PUBFUN = 282,
-     PUBTYPE = 283,
-     END = 284,
-     MU = 285,
-     IN = 286,
-     WHEREREC = 287,
-     WHERE = 288,
-     ELSE = 289,
-     BIN_BASE = 290,
-     LBINARY1 = 291,
-     RBINARY1 = 292,
-     LBINARY2 = 293,
-     RBINARY2 = 294,
-     LBINARY3 = 295,
-     RBINARY3 = 296,
-     LBINARY4 = 297,
-     RBINARY4 = 298,
-     LBINARY5 = 299,
-     RBINARY5 = 300,
-     LBINARY6 = 301,
-     RBINARY6 = 302,
-     LBINARY7 = 303,
-     RBINARY7 = 304,
-     LBINARY8 = 305,
-     RBINARY8 = 306,
-     LBINARY9 = 307,
-     RBINARY9 = 308,
-     NONOP = 309,
-     LAMBDA = 310,
-     IF = 311,
-     LETREC = 312,
-     LET = 313,
-     CHAR = 314,
-     LITERAL = 315,
-     NUMBER = 316,
-     IDENT = 317,
-     APPLY = 318,
-     ALWAYS_REDUCE = 319
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    TYPEVAR = 258,                 /* TYPEVAR  */
+    ABSTYPE = 259,                 /* ABSTYPE  */
+    DATA = 260,                    /* DATA  */
+    TYPESYM = 261,                 /* TYPESYM  */
+    DEC = 262,                     /* DEC  */
+    INFIX = 263,                   /* INFIX  */
+    INFIXR = 264,                  /* INFIXR  */
+    USES = 265,                    /* USES  */
+    PRIVATE = 266,                 /* PRIVATE  */
+    DISPLAY = 267,                 /* DISPLAY  */
+    SAVE = 268,                    /* SAVE  */
+    WRITE = 269,                   /* WRITE  */
+    TO = 270,                      /* TO  */
+    EXIT = 271,                    /* EXIT  */
+    EDIT = 272,                    /* EDIT  */
+    RESET = 273,                   /* RESET  */
+    DEFEQ = 274,                   /* DEFEQ  */
+    OR = 275,                      /* OR  */
+    VALOF = 276,                   /* VALOF  */
+    IS = 277,                      /* IS  */
+    GIVES = 278,                   /* GIVES  */
+    THEN = 279,                    /* THEN  */
+    FORALL = 280,                  /* FORALL  */
+    MODSYM = 281,                  /* MODSYM  */
+    PUBCONST = 282,                /* PUBCONST  */
+    PUBFUN = 283,                  /* PUBFUN  */
+    PUBTYPE = 284,                 /* PUBTYPE  */
+    END = 285,                     /* END  */
+    MU = 286,                      /* MU  */
+    IN = 287,                      /* IN  */
+    WHERE = 288,                   /* WHERE  */
+    WHEREREC = 289,                /* WHEREREC  */
+    ELSE = 290,                    /* ELSE  */
+    BIN_BASE = 291,                /* BIN_BASE  */
+    LBINARY1 = 292,                /* LBINARY1  */
+    RBINARY1 = 293,                /* RBINARY1  */
+    LBINARY2 = 294,                /* LBINARY2  */
+    RBINARY2 = 295,                /* RBINARY2  */
+    LBINARY3 = 296,                /* LBINARY3  */
+    RBINARY3 = 297,                /* RBINARY3  */
+    LBINARY4 = 298,                /* LBINARY4  */
+    RBINARY4 = 299,                /* RBINARY4  */
+    LBINARY5 = 300,                /* LBINARY5  */
+    RBINARY5 = 301,                /* RBINARY5  */
+    LBINARY6 = 302,                /* LBINARY6  */
+    RBINARY6 = 303,                /* RBINARY6  */
+    LBINARY7 = 304,                /* LBINARY7  */
+    RBINARY7 = 305,                /* RBINARY7  */
+    LBINARY8 = 306,                /* LBINARY8  */
+    RBINARY8 = 307,                /* RBINARY8  */
+    LBINARY9 = 308,                /* LBINARY9  */
+    RBINARY9 = 309,                /* RBINARY9  */
+    APPLY = 310,                   /* APPLY  */
+    IDENT = 311,                   /* IDENT  */
+    NUMBER = 312,                  /* NUMBER  */
+    LITERAL = 313,                 /* LITERAL  */
+    CHAR = 314,                    /* CHAR  */
+    LET = 315,                     /* LET  */
+    LETREC = 316,                  /* LETREC  */
+    IF = 317,                      /* IF  */
+    LAMBDA = 318,                  /* LAMBDA  */
+    NONOP = 319,                   /* NONOP  */
+    ALWAYS_REDUCE = 320            /* ALWAYS_REDUCE  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define TYPEVAR 258
 #define ABSTYPE 259
 #define DATA 260
@@ -108,60 +140,61 @@
 #define TO 270
 #define EXIT 271
 #define EDIT 272
-#define DEFEQ 273
-#define OR 274
-#define VALOF 275
-#define IS 276
-#define GIVES 277
-#define THEN 278
-#define FORALL 279
-#define MODSYM 280
-#define PUBCONST 281
-#define PUBFUN 282
-#define PUBTYPE 283
-#define END 284
-#define MU 285
-#define IN 286
-#define WHEREREC 287
+#define RESET 273
+#define DEFEQ 274
+#define OR 275
+#define VALOF 276
+#define IS 277
+#define GIVES 278
+#define THEN 279
+#define FORALL 280
+#define MODSYM 281
+#define PUBCONST 282
+#define PUBFUN 283
+#define PUBTYPE 284
+#define END 285
+#define MU 286
+#define IN 287
 #define WHERE 288
-#define ELSE 289
-#define BIN_BASE 290
-#define LBINARY1 291
-#define RBINARY1 292
-#define LBINARY2 293
-#define RBINARY2 294
-#define LBINARY3 295
-#define RBINARY3 296
-#define LBINARY4 297
-#define RBINARY4 298
-#define LBINARY5 299
-#define RBINARY5 300
-#define LBINARY6 301
-#define RBINARY6 302
-#define LBINARY7 303
-#define RBINARY7 304
-#define LBINARY8 305
-#define RBINARY8 306
-#define LBINARY9 307
-#define RBINARY9 308
-#define NONOP 309
-#define LAMBDA 310
-#define IF 311
-#define LETREC 312
-#define LET 313
+#define WHEREREC 289
+#define ELSE 290
+#define BIN_BASE 291
+#define LBINARY1 292
+#define RBINARY1 293
+#define LBINARY2 294
+#define RBINARY2 295
+#define LBINARY3 296
+#define RBINARY3 297
+#define LBINARY4 298
+#define RBINARY4 299
+#define LBINARY5 300
+#define RBINARY5 301
+#define LBINARY6 302
+#define RBINARY6 303
+#define LBINARY7 304
+#define RBINARY7 305
+#define LBINARY8 306
+#define RBINARY8 307
+#define LBINARY9 308
+#define RBINARY9 309
+#define APPLY 310
+#define IDENT 311
+#define NUMBER 312
+#define LITERAL 313
 #define CHAR 314
-#define LITERAL 315
-#define NUMBER 316
-#define IDENT 317
-#define APPLY 318
-#define ALWAYS_REDUCE 319
-
+#define LET 315
+#define LETREC 316
+#define IF 317
+#define LAMBDA 318
+#define NONOP 319
+#define ALWAYS_REDUCE 320
 
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 102 "y.tab.y"
 
-
-#if ! defined (YYSTYPE) && ! defined (YYSTYPE_IS_DECLARED)
-#line 101 "y.tab.y"
-typedef union YYSTYPE {
 	Num	numval;
 	int	intval;
 	Text	*textval;
@@ -174,15 +207,20 @@ typedef union YYSTYPE {
 	Expr	*expr;
 	Branch	*branch;
 	Cons	*cons;
-} YYSTYPE;
-/* Line 1240 of yacc.c.  */
-#line 180 "y.tab.h"
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
+
+#line 212 "y.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
 #endif
 
+
 extern YYSTYPE yylval;
 
 
+int yyparse (void);
+
 
+#endif /* !YY_YY_Y_TAB_H_INCLUDED  */
@@ -9,13 +9,14 @@
 #include "deftype.h"
 #include "cons.h"
 #include "eval.h"
+#include "heap.h"
 #include "error.h"
 #include "text.h"
 %}
 
 %token	TYPEVAR ABSTYPE DATA TYPESYM
 %token	DEC INFIX INFIXR USES PRIVATE
-%token	DISPLAY SAVE WRITE TO EXIT EDIT
+%token	DISPLAY SAVE WRITE TO EXIT EDIT RESET
 %token	DEFEQ	/* == */
 %token	OR	/* ++ */
 %token	VALOF	/* --- */
@@ -153,6 +154,7 @@ cmd	:	TYPEVAR newtvlist
 	|	WRITE expr TO LITERAL
 				{ wr_expr($2, (const char *)($4->t_start)); }
 	|	DISPLAY		{ display(); }
+	|	RESET		{ reset_cafs(); }
 	|	USES uselist	{ preserve(); }
 	|	SAVE ident	{ mod_save($2); }
 	|	EDIT		{ edit(nullptr); }